@@ -132,8 +132,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_KEYSET5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_KEYSET4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_KEYSET_CASE(parent, 4, VARNAMESTR_FROM_TUPLE var5, var5)
+#define _IMPLEMENT_BINDING_KEYSET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYSET5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_KEYSET_CASE(parent, 5, VARNAMESTR_FROM_TUPLE var6, var6)
+#define _IMPLEMENT_BINDING_KEYSET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYSET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYSET_CASE(parent, 6, VARNAMESTR_FROM_TUPLE var7, var7)
+#define _IMPLEMENT_BINDING_KEYSET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYSET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYSET_CASE(parent, 7, VARNAMESTR_FROM_TUPLE var8, var8)
+#define _IMPLEMENT_BINDING_KEYSET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYSET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYSET_CASE(parent, 8, VARNAMESTR_FROM_TUPLE var9, var9)
+#define _IMPLEMENT_BINDING_KEYSET10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_KEYSET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYSET_CASE(parent, 9, VARNAMESTR_FROM_TUPLE var10, var10)
 #define _IMPLEMENT_BINDING_KEYSET(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_KEYSET10, \
+               _IMPLEMENT_BINDING_KEYSET9, \
+               _IMPLEMENT_BINDING_KEYSET8, \
+               _IMPLEMENT_BINDING_KEYSET7, \
+               _IMPLEMENT_BINDING_KEYSET6, \
                _IMPLEMENT_BINDING_KEYSET5, \
                _IMPLEMENT_BINDING_KEYSET4, \
                _IMPLEMENT_BINDING_KEYSET3, \
@@ -157,8 +177,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_INDEXSET5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_INDEXSET4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 4, var5)
+#define _IMPLEMENT_BINDING_INDEXSET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXSET5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 5, var6)
+#define _IMPLEMENT_BINDING_INDEXSET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXSET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 6, var7)
+#define _IMPLEMENT_BINDING_INDEXSET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXSET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 7, var8)
+#define _IMPLEMENT_BINDING_INDEXSET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXSET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 8, var9)
+#define _IMPLEMENT_BINDING_INDEXSET10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_INDEXSET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXSET_CASE(parent, 9, var10)
 #define _IMPLEMENT_BINDING_INDEXSET(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_INDEXSET10, \
+               _IMPLEMENT_BINDING_INDEXSET9, \
+               _IMPLEMENT_BINDING_INDEXSET8, \
+               _IMPLEMENT_BINDING_INDEXSET7, \
+               _IMPLEMENT_BINDING_INDEXSET6, \
                _IMPLEMENT_BINDING_INDEXSET5, \
                _IMPLEMENT_BINDING_INDEXSET4, \
                _IMPLEMENT_BINDING_INDEXSET3, \
@@ -182,8 +222,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_KEYGET5(var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_KEYGET4(var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_KEYGET_CASE(4, VARNAMESTR_FROM_TUPLE var5, var5)
+#define _IMPLEMENT_BINDING_KEYGET6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGET5(var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_KEYGET_CASE(5, VARNAMESTR_FROM_TUPLE var6, var6)
+#define _IMPLEMENT_BINDING_KEYGET7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGET6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGET_CASE(6, VARNAMESTR_FROM_TUPLE var7, var7)
+#define _IMPLEMENT_BINDING_KEYGET8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGET7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGET_CASE(7, VARNAMESTR_FROM_TUPLE var8, var8)
+#define _IMPLEMENT_BINDING_KEYGET9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGET8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGET_CASE(8, VARNAMESTR_FROM_TUPLE var9, var9)
+#define _IMPLEMENT_BINDING_KEYGET10(var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_KEYGET9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGET_CASE(9, VARNAMESTR_FROM_TUPLE var10, var10)
 #define _IMPLEMENT_BINDING_KEYGET(...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_KEYGET10, \
+               _IMPLEMENT_BINDING_KEYGET9, \
+               _IMPLEMENT_BINDING_KEYGET8, \
+               _IMPLEMENT_BINDING_KEYGET7, \
+               _IMPLEMENT_BINDING_KEYGET6, \
                _IMPLEMENT_BINDING_KEYGET5, \
                _IMPLEMENT_BINDING_KEYGET4, \
                _IMPLEMENT_BINDING_KEYGET3, \
@@ -207,8 +267,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_INDEXGET5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_INDEXGET4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 4, var5)
+#define _IMPLEMENT_BINDING_INDEXGET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGET5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 5, var6)
+#define _IMPLEMENT_BINDING_INDEXGET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGET6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 6, var7)
+#define _IMPLEMENT_BINDING_INDEXGET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGET7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 7, var8)
+#define _IMPLEMENT_BINDING_INDEXGET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGET8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 8, var9)
+#define _IMPLEMENT_BINDING_INDEXGET10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_INDEXGET9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGET_CASE(parent, 9, var10)
 #define _IMPLEMENT_BINDING_INDEXGET(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_INDEXGET10, \
+               _IMPLEMENT_BINDING_INDEXGET9, \
+               _IMPLEMENT_BINDING_INDEXGET8, \
+               _IMPLEMENT_BINDING_INDEXGET7, \
+               _IMPLEMENT_BINDING_INDEXGET6, \
                _IMPLEMENT_BINDING_INDEXGET5, \
                _IMPLEMENT_BINDING_INDEXGET4, \
                _IMPLEMENT_BINDING_INDEXGET3, \
@@ -232,8 +312,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_KEYGETTYPE5(var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_KEYGETTYPE4(var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_KEYGETTYPE_CASE(4, VARNAMESTR_FROM_TUPLE var5, var5)
+#define _IMPLEMENT_BINDING_KEYGETTYPE6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGETTYPE5(var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_KEYGETTYPE_CASE(5, VARNAMESTR_FROM_TUPLE var6, var6)
+#define _IMPLEMENT_BINDING_KEYGETTYPE7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGETTYPE6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGETTYPE_CASE(6, VARNAMESTR_FROM_TUPLE var7, var7)
+#define _IMPLEMENT_BINDING_KEYGETTYPE8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGETTYPE7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGETTYPE_CASE(7, VARNAMESTR_FROM_TUPLE var8, var8)
+#define _IMPLEMENT_BINDING_KEYGETTYPE9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGETTYPE8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGETTYPE_CASE(8, VARNAMESTR_FROM_TUPLE var9, var9)
+#define _IMPLEMENT_BINDING_KEYGETTYPE10(var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_KEYGETTYPE9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGETTYPE_CASE(9, VARNAMESTR_FROM_TUPLE var10, var10)
 #define _IMPLEMENT_BINDING_KEYGETTYPE(...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_KEYGETTYPE10, \
+               _IMPLEMENT_BINDING_KEYGETTYPE9, \
+               _IMPLEMENT_BINDING_KEYGETTYPE8, \
+               _IMPLEMENT_BINDING_KEYGETTYPE7, \
+               _IMPLEMENT_BINDING_KEYGETTYPE6, \
                _IMPLEMENT_BINDING_KEYGETTYPE5, \
                _IMPLEMENT_BINDING_KEYGETTYPE4, \
                _IMPLEMENT_BINDING_KEYGETTYPE3, \
@@ -257,8 +357,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_INDEXGETTYPE5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_INDEXGETTYPE4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 4, var5)
+#define _IMPLEMENT_BINDING_INDEXGETTYPE6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 5, var6)
+#define _IMPLEMENT_BINDING_INDEXGETTYPE7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 6, var7)
+#define _IMPLEMENT_BINDING_INDEXGETTYPE8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 7, var8)
+#define _IMPLEMENT_BINDING_INDEXGETTYPE9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 8, var9)
+#define _IMPLEMENT_BINDING_INDEXGETTYPE10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGETTYPE_CASE(parent, 9, var10)
 #define _IMPLEMENT_BINDING_INDEXGETTYPE(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_INDEXGETTYPE10, \
+               _IMPLEMENT_BINDING_INDEXGETTYPE9, \
+               _IMPLEMENT_BINDING_INDEXGETTYPE8, \
+               _IMPLEMENT_BINDING_INDEXGETTYPE7, \
+               _IMPLEMENT_BINDING_INDEXGETTYPE6, \
                _IMPLEMENT_BINDING_INDEXGETTYPE5, \
                _IMPLEMENT_BINDING_INDEXGETTYPE4, \
                _IMPLEMENT_BINDING_INDEXGETTYPE3, \
@@ -282,8 +402,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_KEYGETHOLDMODE5(var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_KEYGETHOLDMODE4(var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(4, VARNAMESTR_FROM_TUPLE var5, var5)
+#define _IMPLEMENT_BINDING_KEYGETHOLDMODE6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE5(var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(5, VARNAMESTR_FROM_TUPLE var6, var6)
+#define _IMPLEMENT_BINDING_KEYGETHOLDMODE7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE6(var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(6, VARNAMESTR_FROM_TUPLE var7, var7)
+#define _IMPLEMENT_BINDING_KEYGETHOLDMODE8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE7(var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(7, VARNAMESTR_FROM_TUPLE var8, var8)
+#define _IMPLEMENT_BINDING_KEYGETHOLDMODE9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE8(var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(8, VARNAMESTR_FROM_TUPLE var9, var9)
+#define _IMPLEMENT_BINDING_KEYGETHOLDMODE10(var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE9(var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_KEYGETHOLDMODE_CASE(9, VARNAMESTR_FROM_TUPLE var10, var10)
 #define _IMPLEMENT_BINDING_KEYGETHOLDMODE(...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_KEYGETHOLDMODE10, \
+               _IMPLEMENT_BINDING_KEYGETHOLDMODE9, \
+               _IMPLEMENT_BINDING_KEYGETHOLDMODE8, \
+               _IMPLEMENT_BINDING_KEYGETHOLDMODE7, \
+               _IMPLEMENT_BINDING_KEYGETHOLDMODE6, \
                _IMPLEMENT_BINDING_KEYGETHOLDMODE5, \
                _IMPLEMENT_BINDING_KEYGETHOLDMODE4, \
                _IMPLEMENT_BINDING_KEYGETHOLDMODE3, \
@@ -307,8 +447,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_INDEXGETHOLDMODE5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_INDEXGETHOLDMODE4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 4, var5)
+#define _IMPLEMENT_BINDING_INDEXGETHOLDMODE6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 5, var6)
+#define _IMPLEMENT_BINDING_INDEXGETHOLDMODE7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 6, var7)
+#define _IMPLEMENT_BINDING_INDEXGETHOLDMODE8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 7, var8)
+#define _IMPLEMENT_BINDING_INDEXGETHOLDMODE9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 8, var9)
+#define _IMPLEMENT_BINDING_INDEXGETHOLDMODE10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_INDEXGETHOLDMODE_CASE(parent, 9, var10)
 #define _IMPLEMENT_BINDING_INDEXGETHOLDMODE(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_INDEXGETHOLDMODE10, \
+               _IMPLEMENT_BINDING_INDEXGETHOLDMODE9, \
+               _IMPLEMENT_BINDING_INDEXGETHOLDMODE8, \
+               _IMPLEMENT_BINDING_INDEXGETHOLDMODE7, \
+               _IMPLEMENT_BINDING_INDEXGETHOLDMODE6, \
                _IMPLEMENT_BINDING_INDEXGETHOLDMODE5, \
                _IMPLEMENT_BINDING_INDEXGETHOLDMODE4, \
                _IMPLEMENT_BINDING_INDEXGETHOLDMODE3, \
@@ -332,8 +492,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_GETKEY5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_GETKEY4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_GETKEY_CASE(parent, 4, VARNAMESTR_FROM_TUPLE var5)
+#define _IMPLEMENT_BINDING_GETKEY6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_GETKEY5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_GETKEY_CASE(parent, 5, VARNAMESTR_FROM_TUPLE var6)
+#define _IMPLEMENT_BINDING_GETKEY7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_GETKEY6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_GETKEY_CASE(parent, 6, VARNAMESTR_FROM_TUPLE var7)
+#define _IMPLEMENT_BINDING_GETKEY8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_GETKEY7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_GETKEY_CASE(parent, 7, VARNAMESTR_FROM_TUPLE var8)
+#define _IMPLEMENT_BINDING_GETKEY9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_GETKEY8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_GETKEY_CASE(parent, 8, VARNAMESTR_FROM_TUPLE var9)
+#define _IMPLEMENT_BINDING_GETKEY10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_GETKEY9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_GETKEY_CASE(parent, 9, VARNAMESTR_FROM_TUPLE var10)
 #define _IMPLEMENT_BINDING_GETKEY(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_GETKEY10, \
+               _IMPLEMENT_BINDING_GETKEY9, \
+               _IMPLEMENT_BINDING_GETKEY8, \
+               _IMPLEMENT_BINDING_GETKEY7, \
+               _IMPLEMENT_BINDING_GETKEY6, \
                _IMPLEMENT_BINDING_GETKEY5, \
                _IMPLEMENT_BINDING_GETKEY4, \
                _IMPLEMENT_BINDING_GETKEY3, \
@@ -357,8 +537,28 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
 #define _IMPLEMENT_BINDING_FINDINDEX5(parent, var1, var2, var3, var4, var5) \
   _IMPLEMENT_BINDING_FINDINDEX4(parent, var1, var2, var3, var4) \
   _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 4, VARNAMESTR_FROM_TUPLE var5)
+#define _IMPLEMENT_BINDING_FINDINDEX6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_FINDINDEX5(parent, var1, var2, var3, var4, var5) \
+  _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 5, VARNAMESTR_FROM_TUPLE var6)
+#define _IMPLEMENT_BINDING_FINDINDEX7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_FINDINDEX6(parent, var1, var2, var3, var4, var5, var6) \
+  _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 6, VARNAMESTR_FROM_TUPLE var7)
+#define _IMPLEMENT_BINDING_FINDINDEX8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_FINDINDEX7(parent, var1, var2, var3, var4, var5, var6, var7) \
+  _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 7, VARNAMESTR_FROM_TUPLE var8)
+#define _IMPLEMENT_BINDING_FINDINDEX9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_FINDINDEX8(parent, var1, var2, var3, var4, var5, var6, var7, var8) \
+  _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 8, VARNAMESTR_FROM_TUPLE var9)
+#define _IMPLEMENT_BINDING_FINDINDEX10(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9, var10) \
+  _IMPLEMENT_BINDING_FINDINDEX9(parent, var1, var2, var3, var4, var5, var6, var7, var8, var9) \
+  _IMPLEMENT_BINDING_FINDINDEX_CASE(parent, 9, VARNAMESTR_FROM_TUPLE var10)
 #define _IMPLEMENT_BINDING_FINDINDEX(parent, ...) \
-  SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, \
+  SELECT_MACRO(__VA_ARGS__, \
+               _IMPLEMENT_BINDING_FINDINDEX10, \
+               _IMPLEMENT_BINDING_FINDINDEX9, \
+               _IMPLEMENT_BINDING_FINDINDEX8, \
+               _IMPLEMENT_BINDING_FINDINDEX7, \
+               _IMPLEMENT_BINDING_FINDINDEX6, \
                _IMPLEMENT_BINDING_FINDINDEX5, \
                _IMPLEMENT_BINDING_FINDINDEX4, \
                _IMPLEMENT_BINDING_FINDINDEX3, \
@@ -380,7 +580,7 @@ inline TiObject* tryGetMember(TiObject *obj, Char const *name)
   } \
   public: virtual Word getMemberCount() const \
   { \
-    return SELECT_MACRO(__VA_ARGS__, _, _, _, _, _, 5, 4, 3, 2, 1) + parent::getMemberCount(); \
+    return SELECT_MACRO(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1) + parent::getMemberCount(); \
   } \
   public: using Binding::getMember; \
   public: virtual TiObject* getMember(Char const *key) const \
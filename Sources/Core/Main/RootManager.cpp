@@ -49,6 +49,12 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   this->interactive = false;
   this->processArgCount = 0;
   this->processArgs = 0;
+  this->jitThreadCount = 0;
+  this->jitTierUpThreshold = 0;
+  this->jitCacheEnabled = true;
+  this->jitPerfMapEnabled = false;
+  this->jitDumpEnabled = false;
+  this->jitDebugInfoLevel = 0;
 
   this->coreBinPath = getModuleDirectory();
 
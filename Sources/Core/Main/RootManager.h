@@ -61,6 +61,12 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
   private: Char const *const *processArgs;
   private: Str language;
   private: Str coreBinPath;
+  private: Int jitThreadCount;
+  private: Int jitTierUpThreshold;
+  private: Bool jitCacheEnabled;
+  private: Bool jitPerfMapEnabled;
+  private: Bool jitDumpEnabled;
+  private: Int jitDebugInfoLevel;
 
 
   //============================================================================
@@ -201,6 +207,67 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->coreBinPath;
   }
 
+  public: void setJitThreadCount(Int count)
+  {
+    this->jitThreadCount = count;
+  }
+
+  public: Int getJitThreadCount() const
+  {
+    return this->jitThreadCount;
+  }
+
+  public: void setJitTierUpThreshold(Int threshold)
+  {
+    this->jitTierUpThreshold = threshold;
+  }
+
+  public: Int getJitTierUpThreshold() const
+  {
+    return this->jitTierUpThreshold;
+  }
+
+  public: void setJitCacheEnabled(Bool enabled)
+  {
+    this->jitCacheEnabled = enabled;
+  }
+
+  public: Bool isJitCacheEnabled() const
+  {
+    return this->jitCacheEnabled;
+  }
+
+  public: void setJitPerfMapEnabled(Bool enabled)
+  {
+    this->jitPerfMapEnabled = enabled;
+  }
+
+  public: Bool isJitPerfMapEnabled() const
+  {
+    return this->jitPerfMapEnabled;
+  }
+
+  public: void setJitDumpEnabled(Bool enabled)
+  {
+    this->jitDumpEnabled = enabled;
+  }
+
+  public: Bool isJitDumpEnabled() const
+  {
+    return this->jitDumpEnabled;
+  }
+
+  /// 0 for no debug info, 1 for line tables only, and 2 for full debug info.
+  public: void setJitDebugInfoLevel(Int level)
+  {
+    this->jitDebugInfoLevel = level;
+  }
+
+  public: Int getJitDebugInfoLevel() const
+  {
+    return this->jitDebugInfoLevel;
+  }
+
 }; // class
 
 } // namespace
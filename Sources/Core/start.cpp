@@ -52,6 +52,12 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Int jitThreadCount = 0;
+  Int jitTierUpThreshold = 0;
+  Bool jitCache = true;
+  Bool jitPerfMap = false;
+  Bool jitDump = false;
+  Int jitDebugInfoLevel = 0;
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
     if (strcmp(args[i], S("--help")) == 0) help = true;
@@ -62,6 +68,38 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    // Parse the JIT threads option.
+    else if (strcmp(args[i], S("--jit-threads")) == 0 || strcmp(args[i], S("--خيوط_الترجمة")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        jitThreadCount = atoi(args[i]);
+      }
+    }
+    // Parse the JIT tier up option.
+    else if (strcmp(args[i], S("--jit-tier-up")) == 0 || strcmp(args[i], S("--ترقية_الترجمة")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        jitTierUpThreshold = atoi(args[i]);
+      }
+    }
+    else if (strcmp(args[i], S("--no-jit-cache")) == 0) jitCache = false;
+    else if (strcmp(args[i], S("--بلا_خبيئة_الترجمة")) == 0) jitCache = false;
+    else if (strcmp(args[i], S("--jit-perf-map")) == 0) jitPerfMap = true;
+    else if (strcmp(args[i], S("--خريطة_أداء_الترجمة")) == 0) jitPerfMap = true;
+    else if (strcmp(args[i], S("--jit-dump")) == 0) jitDump = true;
+    else if (strcmp(args[i], S("--تفريغ_الترجمة")) == 0) jitDump = true;
+    // Parse the JIT debug info option.
+    else if (strcmp(args[i], S("--jit-debug-info")) == 0 || strcmp(args[i], S("--معلومات_تنقيح_الترجمة")) == 0) {
+      jitDebugInfoLevel = 2;
+      if (i < argCount-1) {
+        if (strcmp(args[i+1], S("lines")) == 0 || strcmp(args[i+1], S("أسطر")) == 0) {
+          ++i;
+          jitDebugInfoLevel = 1;
+        } else if (strcmp(args[i+1], S("full")) == 0 || strcmp(args[i+1], S("كاملة")) == 0) {
+          ++i;
+        }
+      }
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -118,6 +156,24 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tعدد خيوط الترجمة الفورية (JIT) المتوازية:\n");
+      outStream << S("\t\t--خيوط_الترجمة\n");
+      outStream << S("\t\t--jit-threads\n");
+      outStream << S("\tعدد الاستدعاءات التي تُعاد بعدها ترجمة الدالة مع التحسين الكامل:\n");
+      outStream << S("\t\t--ترقية_الترجمة\n");
+      outStream << S("\t\t--jit-tier-up\n");
+      outStream << S("\tتعطيل خبيئة الشفرة المترجمة على القرص:\n");
+      outStream << S("\t\t--بلا_خبيئة_الترجمة\n");
+      outStream << S("\t\t--no-jit-cache\n");
+      outStream << S("\tكتابة أسماء الدالات المترجمة في /tmp/perf-<pid>.map لأدوات قياس الأداء:\n");
+      outStream << S("\t\t--خريطة_أداء_الترجمة\n");
+      outStream << S("\t\t--jit-perf-map\n");
+      outStream << S("\tكتابة الشفرة المترجمة في ملف jitdump لأداة perf:\n");
+      outStream << S("\t\t--تفريغ_الترجمة\n");
+      outStream << S("\t\t--jit-dump\n");
+      outStream << S("\tتوليد معلومات التنقيح للشفرة المترجمة فوريًا (أسطر أو كاملة):\n");
+      outStream << S("\t\t--معلومات_تنقيح_الترجمة\n");
+      outStream << S("\t\t--jit-debug-info\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +194,12 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--jit-threads  The number of threads used for compiling JIT code in parallel.\n");
+      outStream << S("\t--jit-tier-up  Fully optimize JIT functions only after they are called the given number of times.\n");
+      outStream << S("\t--no-jit-cache  Do not store JIT compiled code in, or load it from, the on-disk cache.\n");
+      outStream << S("\t--jit-perf-map  Write the names of JIT compiled functions to /tmp/perf-<pid>.map for profilers.\n");
+      outStream << S("\t--jit-dump  Write JIT compiled code to a jitdump file for perf.\n");
+      outStream << S("\t--jit-debug-info  Generate debug info for JIT compiled code, `lines` or `full` (default).\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -158,6 +220,12 @@ int main(int argCount, char * const args[])
       Main::RootManager root;
       root.setInteractive(true);
       root.setProcessArgInfo(argCount, args);
+      root.setJitThreadCount(jitThreadCount);
+      root.setJitTierUpThreshold(jitTierUpThreshold);
+      root.setJitCacheEnabled(jitCache);
+      root.setJitPerfMapEnabled(jitPerfMap);
+      root.setJitDumpEnabled(jitDump);
+      root.setJitDebugInfoLevel(jitDebugInfoLevel);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
         [](SharedPtr<Notices::Notice> const &notice)->void
@@ -183,6 +251,12 @@ int main(int argCount, char * const args[])
       // Prepare the root object;
       Main::RootManager root;
       root.setProcessArgInfo(argCount, args);
+      root.setJitThreadCount(jitThreadCount);
+      root.setJitTierUpThreshold(jitTierUpThreshold);
+      root.setJitCacheEnabled(jitCache);
+      root.setJitPerfMapEnabled(jitPerfMap);
+      root.setJitDumpEnabled(jitDump);
+      root.setJitDebugInfoLevel(jitDebugInfoLevel);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
         [](SharedPtr<Notices::Notice> const &notice)->void
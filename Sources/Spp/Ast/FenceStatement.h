@@ -0,0 +1,93 @@
+/**
+ * @file Spp/Ast/FenceStatement.h
+ * Contains the header of class Spp::Ast::FenceStatement.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_FENCESTATEMENT_H
+#define SPP_AST_FENCESTATEMENT_H
+
+namespace Spp::Ast
+{
+
+class FenceStatement : public Core::Data::Node,
+                       public Binding, public MapContaining<TiObject>,
+                       public Core::Data::Ast::MetaHaving, public Core::Data::Printable
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(FenceStatement, Core::Data::Node, "Spp.Ast", "Spp", "alusus.org");
+  IMPLEMENT_INTERFACES(
+    Core::Data::Node, Binding, MapContaining<TiObject>,
+    Core::Data::Ast::MetaHaving, Core::Data::Printable
+  );
+  OBJECT_FACTORY(FenceStatement);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: TioSharedPtr ordering;
+
+
+  //============================================================================
+  // Implementations
+
+  IMPLEMENT_METAHAVING(FenceStatement);
+
+  IMPLEMENT_BINDING(Binding,
+    (prodId, TiWord, VALUE, setProdId(value), &prodId),
+    (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
+  );
+
+  IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
+    (ordering, TiObject, SHARED_REF, setOrdering(value), ordering.get())
+  );
+
+  IMPLEMENT_AST_MAP_PRINTABLE(FenceStatement);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(FenceStatement);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(FenceStatement);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(FenceStatement);
+
+  public: virtual ~FenceStatement()
+  {
+    DISOWN_SHAREDPTR(this->ordering);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setOrdering(TioSharedPtr const &s)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->ordering, s);
+  }
+  private: void setOrdering(TiObject *s)
+  {
+    this->setOrdering(getSharedPtr(s));
+  }
+
+  public: TioSharedPtr const& getOrdering() const
+  {
+    return this->ordering;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -40,6 +40,7 @@ class ForStatement : public Core::Data::Node,
   private: TioSharedPtr condition;
   private: TioSharedPtr updater;
   private: TioSharedPtr body;
+  private: SharedPtr<Core::Data::Ast::List> modifiers;
 
 
   //============================================================================
@@ -56,7 +57,8 @@ class ForStatement : public Core::Data::Node,
     (initializer, TiObject, SHARED_REF, setInitializer(value), initializer.get()),
     (condition, TiObject, SHARED_REF, setCondition(value), condition.get()),
     (updater, TiObject, SHARED_REF, setUpdater(value), updater.get()),
-    (body, TiObject, SHARED_REF, setBody(value), body.get())
+    (body, TiObject, SHARED_REF, setBody(value), body.get()),
+    (modifiers, Core::Data::Ast::List, SHARED_REF, setModifiers(value), modifiers.get())
   );
 
   IMPLEMENT_AST_MAP_PRINTABLE(ForStatement);
@@ -77,6 +79,7 @@ class ForStatement : public Core::Data::Node,
     DISOWN_SHAREDPTR(this->condition);
     DISOWN_SHAREDPTR(this->updater);
     DISOWN_SHAREDPTR(this->body);
+    DISOWN_SHAREDPTR(this->modifiers);
   }
 
 
@@ -139,6 +142,30 @@ class ForStatement : public Core::Data::Node,
     return this->body;
   }
 
+  /// The loop's modifiers, which carry optimization hints like unroll and vectorize.
+  public: void setModifiers(SharedPtr<Core::Data::Ast::List> const &m)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->modifiers, m);
+  }
+  private: void setModifiers(Core::Data::Ast::List *m)
+  {
+    this->setModifiers(getSharedPtr(m));
+  }
+
+  public: void addModifier(TioSharedPtr const &modifier)
+  {
+    if (this->modifiers == 0) {
+      this->setModifiers(Core::Data::Ast::List::create({}, { modifier }));
+    } else {
+      this->modifiers->add(modifier);
+    }
+  }
+
+  public: SharedPtr<Core::Data::Ast::List> const& getModifiers() const
+  {
+    return this->modifiers;
+  }
+
 }; // class
 
 } // namespace
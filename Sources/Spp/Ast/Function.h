@@ -18,6 +18,9 @@ namespace Spp::Ast
 
 class FunctionType;
 
+ti_s_enum(FunctionInlining, TiInt, "Spp.Ast", "Spp", "alusus.org", DEFAULT, ALWAYS, NEVER);
+ti_s_enum(FunctionHotness, TiInt, "Spp.Ast", "Spp", "alusus.org", DEFAULT, HOT, COLD);
+
 class Function : public Core::Data::Node,
                  public Binding, public MapContaining<TiObject>,
                  public Core::Data::Ast::MetaHaving, public Core::Data::Printable
@@ -38,6 +41,11 @@ class Function : public Core::Data::Node,
 
   private: TiStr name;
   private: TiBool inlined;
+  private: TiBool exported;
+  private: FunctionInlining inlining;
+  private: FunctionHotness hotness;
+  private: TiBool pure;
+  private: TiBool intrinsic;
   private: SharedPtr<FunctionType> type;
   private: SharedPtr<Core::Data::Ast::Scope> body;
 
@@ -50,6 +58,11 @@ class Function : public Core::Data::Node,
   IMPLEMENT_BINDING(Binding,
     (name, TiStr, VALUE, setName(value), &name),
     (inlined, TiBool, VALUE, setInlined(value), &inlined),
+    (exported, TiBool, VALUE, setExported(value), &exported),
+    (inlining, FunctionInlining, VALUE, setInlining(value), &inlining),
+    (hotness, FunctionHotness, VALUE, setHotness(value), &hotness),
+    (pure, TiBool, VALUE, setPure(value), &pure),
+    (intrinsic, TiBool, VALUE, setIntrinsic(value), &intrinsic),
     (prodId, TiWord, VALUE, setProdId(value), &prodId),
     (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
   );
@@ -109,6 +122,86 @@ class Function : public Core::Data::Node,
     return this->inlined;
   }
 
+  /// Whether the function's name was given explicitly using the expname modifier, in which case it must remain
+  /// visible outside the generated program.
+  public: void setExported(Bool e)
+  {
+    this->exported = e;
+  }
+  public: void setExported(TiBool const *e)
+  {
+    this->setExported(e == 0 ? false : e->get());
+  }
+
+  public: Bool getExported() const
+  {
+    return this->exported;
+  }
+
+  /// Whether the function should always be inlined (the inline modifier) or never be inlined (the noinline
+  /// modifier). By default the optimizer decides.
+  public: void setInlining(FunctionInlining const &i)
+  {
+    this->inlining = i;
+  }
+  public: void setInlining(FunctionInlining const *i)
+  {
+    this->inlining = i == 0 ? FunctionInlining::DEFAULT : i->get();
+  }
+
+  public: FunctionInlining const& getInlining() const
+  {
+    return this->inlining;
+  }
+
+  /// Whether the function is marked as frequently executed (the hot modifier) or rarely executed (the cold
+  /// modifier).
+  public: void setHotness(FunctionHotness const &h)
+  {
+    this->hotness = h;
+  }
+  public: void setHotness(FunctionHotness const *h)
+  {
+    this->hotness = h == 0 ? FunctionHotness::DEFAULT : h->get();
+  }
+
+  public: FunctionHotness const& getHotness() const
+  {
+    return this->hotness;
+  }
+
+  /// Whether the function is marked with the pure modifier, promising that it has no side effects other than
+  /// its return value and that it only reads memory, always returning for the same args and memory state.
+  public: void setPure(Bool p)
+  {
+    this->pure = p;
+  }
+  public: void setPure(TiBool const *p)
+  {
+    this->setPure(p == 0 ? false : p->get());
+  }
+
+  public: Bool isPure() const
+  {
+    return this->pure;
+  }
+
+  /// Whether the function is a declaration of a target intrinsic given using the intrinsic modifier, in which case
+  /// the name is the intrinsic's name and calls are lowered directly into the intrinsic.
+  public: void setIntrinsic(Bool i)
+  {
+    this->intrinsic = i;
+  }
+  public: void setIntrinsic(TiBool const *i)
+  {
+    this->setIntrinsic(i == 0 ? false : i->get());
+  }
+
+  public: Bool isIntrinsic() const
+  {
+    return this->intrinsic;
+  }
+
   public: void setType(SharedPtr<FunctionType> const &t)
   {
     UPDATE_OWNED_SHAREDPTR(this->type, t);
@@ -40,6 +40,8 @@ void Helper::initBindingCaches()
     &this->getBoolType,
     &this->getCharType,
     &this->getCharArrayType,
+    &this->getBoolVectorType,
+    &this->getResizedVectorType,
     &this->getArchIntType,
     &this->getIntType,
     &this->getWord64Type,
@@ -78,6 +80,8 @@ void Helper::initBindings()
   this->getBoolType = &Helper::_getBoolType;
   this->getCharType = &Helper::_getCharType;
   this->getCharArrayType = &Helper::_getCharArrayType;
+  this->getBoolVectorType = &Helper::_getBoolVectorType;
+  this->getResizedVectorType = &Helper::_getResizedVectorType;
   this->getArchIntType = &Helper::_getArchIntType;
   this->getIntType = &Helper::_getIntType;
   this->getWord64Type = &Helper::_getWord64Type;
@@ -607,6 +611,73 @@ ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
 }
 
 
+VectorType* Helper::_getBoolVectorType(TiObject *self, Word size)
+{
+  PREPARE_SELF(helper, Helper);
+
+  // Prepare the reference.
+  if (helper->boolVectorTypeRef == 0) {
+    // Create a new reference.
+    StrStream stream;
+    stream << S("vec[Word[1],") << size << S("]");
+    helper->boolVectorTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
+      .s_cast<Core::Data::Ast::ParamPass>();
+    helper->boolVectorTypeRef->setOwner(helper->rootManager->getRootScope().get());
+  } else {
+    // Recycle the existing reference.
+    auto intLiteral = helper->boolVectorTypeRef
+      ->getParam().ti_cast_get<Core::Data::Ast::List>()
+      ->get(1).ti_cast_get<Core::Data::Ast::IntegerLiteral>();
+    if (!intLiteral) {
+      throw EXCEPTION(GenericException, S("Unexpected internal error."));
+    }
+    intLiteral->setValue(std::to_string(size).c_str());
+  }
+  // Seek the requested type.
+  auto astType = ti_cast<Ast::VectorType>(
+    helper->getSeeker()->doGet(helper->boolVectorTypeRef.get(), helper->rootManager->getRootScope().get())
+  );
+  if (astType == 0) {
+    throw EXCEPTION(GenericException, S("Failed to get bool vector AST type."));
+  }
+  return astType;
+}
+
+
+VectorType* Helper::_getResizedVectorType(TiObject *self, VectorType *vectorType, Word size)
+{
+  PREPARE_SELF(helper, Helper);
+
+  // Prepare the reference.
+  if (helper->resizedVectorTypeRef == 0) {
+    // Create a new reference.
+    StrStream stream;
+    stream << S("vec[type,") << size << S("]");
+    helper->resizedVectorTypeRef = helper->rootManager->parseExpression(stream.str().c_str())
+      .s_cast<Core::Data::Ast::ParamPass>();
+  } else {
+    // Recycle the existing reference.
+    auto intLiteral = helper->resizedVectorTypeRef
+      ->getParam().ti_cast_get<Core::Data::Ast::List>()
+      ->get(1).ti_cast_get<Core::Data::Ast::IntegerLiteral>();
+    if (!intLiteral) {
+      throw EXCEPTION(GenericException, S("Unexpected internal error."));
+    }
+    intLiteral->setValue(std::to_string(size).c_str());
+  }
+  // The reference is resolved from within the template instance of the given vector type, which is where the `type`
+  // template var is defined.
+  auto owner = vectorType->getOwner();
+  helper->resizedVectorTypeRef->setOwner(owner);
+  // Seek the requested type.
+  auto astType = ti_cast<Ast::VectorType>(helper->getSeeker()->doGet(helper->resizedVectorTypeRef.get(), owner));
+  if (astType == 0) {
+    throw EXCEPTION(GenericException, S("Failed to get vector AST type."));
+  }
+  return astType;
+}
+
+
 IntegerType* Helper::_getArchIntType(TiObject *self)
 {
   PREPARE_SELF(helper, Helper);
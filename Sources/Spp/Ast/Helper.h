@@ -50,6 +50,8 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   private: SharedPtr<Core::Data::Ast::ParamPass> wordTypeRef;
   private: SharedPtr<Core::Data::Ast::ParamPass> floatTypeRef;
   private: SharedPtr<Core::Data::Ast::ParamPass> charArrayTypeRef;
+  private: SharedPtr<Core::Data::Ast::ParamPass> boolVectorTypeRef;
+  private: SharedPtr<Core::Data::Ast::ParamPass> resizedVectorTypeRef;
 
 
   //============================================================================
@@ -210,6 +212,13 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(getCharArrayType, ArrayType*, (Word));
   private: static ArrayType* _getCharArrayType(TiObject *self, Word size);
 
+  public: METHOD_BINDING_CACHE(getBoolVectorType, VectorType*, (Word));
+  private: static VectorType* _getBoolVectorType(TiObject *self, Word size);
+
+  /// Returns a vector type with the element type of the given vector type and the given size.
+  public: METHOD_BINDING_CACHE(getResizedVectorType, VectorType*, (VectorType*, Word));
+  private: static VectorType* _getResizedVectorType(TiObject *self, VectorType *vectorType, Word size);
+
   public: METHOD_BINDING_CACHE(getArchIntType, IntegerType*);
   private: static IntegerType* _getArchIntType(TiObject *self);
 
@@ -0,0 +1,110 @@
+/**
+ * @file Spp/Ast/ReduceOp.h
+ * Contains the header of class Spp::Ast::ReduceOp.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_REDUCEOP_H
+#define SPP_AST_REDUCEOP_H
+
+namespace Spp::Ast
+{
+
+class ReduceOp : public Core::Data::Node,
+                 public Binding, public MapContaining<TiObject>,
+                 public Core::Data::Ast::MetaHaving, public Core::Data::Printable
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(ReduceOp, Core::Data::Node, "Spp.Ast", "Spp", "alusus.org");
+  IMPLEMENT_INTERFACES(
+    Core::Data::Node, Binding, MapContaining<TiObject>,
+    Core::Data::Ast::MetaHaving, Core::Data::Printable
+  );
+  OBJECT_FACTORY(ReduceOp);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: TioSharedPtr operand;
+  private: TioSharedPtr operation;
+
+
+  //============================================================================
+  // Implementations
+
+  IMPLEMENT_METAHAVING(ReduceOp);
+
+  IMPLEMENT_BINDING(Binding,
+    (prodId, TiWord, VALUE, setProdId(value), &prodId),
+    (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
+  );
+
+  IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
+    (operand, TiObject, SHARED_REF, setOperand(value), operand.get()),
+    (operation, TiObject, SHARED_REF, setOperation(value), operation.get())
+  );
+
+  IMPLEMENT_AST_MAP_PRINTABLE(ReduceOp);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(ReduceOp);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(ReduceOp);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(ReduceOp);
+
+  public: virtual ~ReduceOp()
+  {
+    DISOWN_SHAREDPTR(this->operand);
+    DISOWN_SHAREDPTR(this->operation);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setOperand(TioSharedPtr const &o)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->operand, o);
+  }
+  private: void setOperand(TiObject *o)
+  {
+    this->setOperand(getSharedPtr(o));
+  }
+
+  public: TioSharedPtr const& getOperand() const
+  {
+    return this->operand;
+  }
+
+  public: void setOperation(TioSharedPtr const &o)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->operation, o);
+  }
+  private: void setOperation(TiObject *o)
+  {
+    this->setOperation(getSharedPtr(o));
+  }
+
+  public: TioSharedPtr const& getOperation() const
+  {
+    return this->operation;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @file Spp/Ast/ShuffleOp.h
+ * Contains the header of class Spp::Ast::ShuffleOp.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_SHUFFLEOP_H
+#define SPP_AST_SHUFFLEOP_H
+
+namespace Spp::Ast
+{
+
+class ShuffleOp : public Core::Data::Node,
+                 public Binding, public MapContaining<TiObject>,
+                 public Core::Data::Ast::MetaHaving, public Core::Data::Printable
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(ShuffleOp, Core::Data::Node, "Spp.Ast", "Spp", "alusus.org");
+  IMPLEMENT_INTERFACES(
+    Core::Data::Node, Binding, MapContaining<TiObject>,
+    Core::Data::Ast::MetaHaving, Core::Data::Printable
+  );
+  OBJECT_FACTORY(ShuffleOp);
+
+
+  //============================================================================
+  // Member Variables
+
+  private: TioSharedPtr operand;
+  private: TioSharedPtr indices;
+
+
+  //============================================================================
+  // Implementations
+
+  IMPLEMENT_METAHAVING(ShuffleOp);
+
+  IMPLEMENT_BINDING(Binding,
+    (prodId, TiWord, VALUE, setProdId(value), &prodId),
+    (sourceLocation, Core::Data::SourceLocation, SHARED_REF, setSourceLocation(value), sourceLocation.get())
+  );
+
+  IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
+    (operand, TiObject, SHARED_REF, setOperand(value), operand.get()),
+    (indices, TiObject, SHARED_REF, setIndices(value), indices.get())
+  );
+
+  IMPLEMENT_AST_MAP_PRINTABLE(ShuffleOp);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(ShuffleOp);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(ShuffleOp);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(ShuffleOp);
+
+  public: virtual ~ShuffleOp()
+  {
+    DISOWN_SHAREDPTR(this->operand);
+    DISOWN_SHAREDPTR(this->indices);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setOperand(TioSharedPtr const &o)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->operand, o);
+  }
+  private: void setOperand(TiObject *o)
+  {
+    this->setOperand(getSharedPtr(o));
+  }
+
+  public: TioSharedPtr const& getOperand() const
+  {
+    return this->operand;
+  }
+
+  public: void setIndices(TioSharedPtr const &i)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->indices, i);
+  }
+  private: void setIndices(TiObject *i)
+  {
+    this->setIndices(getSharedPtr(i));
+  }
+
+  public: TioSharedPtr const& getIndices() const
+  {
+    return this->indices;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file Spp/Ast/VectorType.cpp
+ * Contains the implementation of class Spp::Ast::VectorType.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::Ast
+{
+
+//==============================================================================
+// Member Functions
+
+Type* VectorType::getContentType(Helper *helper) const
+{
+  static TioSharedPtr contentTypeRef;
+  if (contentTypeRef == 0) {
+    contentTypeRef = helper->getRootManager()->parseExpression(S("type"));
+  }
+  auto typeBox = ti_cast<TioWeakBox>(
+    helper->getSeeker()->doGet(contentTypeRef.get(), this->getOwner())
+  );
+  if (typeBox == 0) return 0;
+  auto type = typeBox->get().ti_cast_get<Spp::Ast::Type>();
+  if (type == 0) {
+    throw EXCEPTION(GenericException, S("Invalid vector element type found."));
+  }
+  return type;
+}
+
+
+Word VectorType::getSize(Helper *helper) const
+{
+  static TioSharedPtr sizeRef;
+  if (sizeRef == 0) {
+    sizeRef = helper->getRootManager()->parseExpression(S("size"));
+  }
+  auto size = ti_cast<Core::Data::Ast::IntegerLiteral>(
+    helper->getSeeker()->doGet(sizeRef.get(), this->getOwner())
+  );
+  if (size == 0) {
+    throw EXCEPTION(GenericException, S("Could not find size value."));
+  }
+  return std::stol(size->getValue().get());
+}
+
+
+TypeMatchStatus VectorType::matchTargetType(
+  Type const *type, Helper *helper, ExecutionContext const *ec, TypeMatchOptions opts
+) const
+{
+  // Vectors only match vectors of the same element type and size.
+  return this->isIdentical(type, helper) ? TypeMatchStatus::EXACT : TypeMatchStatus::NONE;
+}
+
+
+Bool VectorType::isIdentical(Type const *type, Helper *helper) const
+{
+  if (this == type) return true;
+
+  auto vectorType = ti_cast<VectorType const>(type);
+  if (vectorType == 0) return false;
+
+  auto thisContentType = this->getContentType(helper);
+  auto targetContentType = vectorType->getContentType(helper);
+  auto thisSize = this->getSize(helper);
+  auto targetSize = vectorType->getSize(helper);
+
+  return thisSize == targetSize && thisContentType->isIdentical(targetContentType, helper);
+}
+
+} // namespace
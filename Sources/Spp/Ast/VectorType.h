@@ -0,0 +1,57 @@
+/**
+ * @file Spp/Ast/VectorType.h
+ * Contains the header of class Spp::Ast::VectorType.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_AST_VECTORTYPE_H
+#define SPP_AST_VECTORTYPE_H
+
+namespace Spp::Ast
+{
+
+class VectorType : public DataType
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(VectorType, DataType, "Spp.Ast", "Spp", "alusus.org");
+  OBJECT_FACTORY(VectorType);
+
+  IMPLEMENT_AST_MAP_PRINTABLE(VectorType);
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  IMPLEMENT_EMPTY_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_CONSTRUCTOR(VectorType);
+
+  IMPLEMENT_ATTR_MAP_CONSTRUCTOR(VectorType);
+
+
+  //============================================================================
+  // Member Functions
+
+  public: Type* getContentType(Helper *helper) const;
+
+  public: Word getSize(Helper *helper) const;
+
+  public: virtual TypeMatchStatus matchTargetType(
+    Type const *type, Helper *helper, ExecutionContext const *ec, TypeMatchOptions opts = TypeMatchOptions::NONE
+  ) const;
+
+  public: virtual Bool isIdentical(Type const *type, Helper *helper) const;
+
+}; // class
+
+} // namespace
+
+#endif
@@ -36,6 +36,7 @@ class WhileStatement : public Core::Data::Node,
 
   private: TioSharedPtr condition;
   private: TioSharedPtr body;
+  private: SharedPtr<Core::Data::Ast::List> modifiers;
 
 
   //============================================================================
@@ -50,7 +51,8 @@ class WhileStatement : public Core::Data::Node,
 
   IMPLEMENT_MAP_CONTAINING(MapContaining<TiObject>,
     (condition, TiObject, SHARED_REF, setCondition(value), condition.get()),
-    (body, TiObject, SHARED_REF, setBody(value), body.get())
+    (body, TiObject, SHARED_REF, setBody(value), body.get()),
+    (modifiers, Core::Data::Ast::List, SHARED_REF, setModifiers(value), modifiers.get())
   );
 
   IMPLEMENT_AST_MAP_PRINTABLE(WhileStatement);
@@ -69,6 +71,7 @@ class WhileStatement : public Core::Data::Node,
   {
     DISOWN_SHAREDPTR(this->condition);
     DISOWN_SHAREDPTR(this->body);
+    DISOWN_SHAREDPTR(this->modifiers);
   }
 
 
@@ -103,6 +106,30 @@ class WhileStatement : public Core::Data::Node,
     return this->body;
   }
 
+  /// The loop's modifiers, which carry optimization hints like unroll and vectorize.
+  public: void setModifiers(SharedPtr<Core::Data::Ast::List> const &m)
+  {
+    UPDATE_OWNED_SHAREDPTR(this->modifiers, m);
+  }
+  private: void setModifiers(Core::Data::Ast::List *m)
+  {
+    this->setModifiers(getSharedPtr(m));
+  }
+
+  public: void addModifier(TioSharedPtr const &modifier)
+  {
+    if (this->modifiers == 0) {
+      this->setModifiers(Core::Data::Ast::List::create({}, { modifier }));
+    } else {
+      this->modifiers->add(modifier);
+    }
+  }
+
+  public: SharedPtr<Core::Data::Ast::List> const& getModifiers() const
+  {
+    return this->modifiers;
+  }
+
 }; // class
 
 } // namespace
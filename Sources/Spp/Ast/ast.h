@@ -106,6 +106,21 @@ s_enum(TypeInitMethod,
   BOTH = 3
 );
 
+/**
+ * @brief The result of folding a constant expression at the AST level.
+ * @ingroup spp_ast
+ *
+ * Integer values are kept in intValue, truncated to the bit count of the type
+ * and sign extended if the type is signed. Float values are kept in
+ * floatValue, rounded to the precision of the type.
+ */
+struct ConstantValue
+{
+  Type *astType = 0;
+  LongInt intValue = 0;
+  Double floatValue = 0;
+};
+
 
 //==============================================================================
 // Forward Class Declarations
@@ -141,6 +156,7 @@ Function* getDummyBuiltInOpFunction();
 #include "PointerType.h"
 #include "ReferenceType.h"
 #include "ArrayType.h"
+#include "VectorType.h"
 #include "UserType.h"
 #include "FunctionType.h"
 #include "Macro.h"
@@ -155,6 +171,7 @@ Function* getDummyBuiltInOpFunction();
 #include "IfStatement.h"
 #include "WhileStatement.h"
 #include "ContinueStatement.h"
+#include "FenceStatement.h"
 #include "BreakStatement.h"
 #include "ReturnStatement.h"
 #include "PreprocessStatement.h"
@@ -170,7 +187,11 @@ Function* getDummyBuiltInOpFunction();
 #include "AstRefOp.h"
 #include "InitOp.h"
 #include "TerminateOp.h"
+#include "MoveOp.h"
 #include "NextArgOp.h"
+#include "ShuffleOp.h"
+#include "ReduceOp.h"
+#include "AtomicOp.h"
 #include "UseInOp.h"
 // Misc
 #include "ArgPack.h"
@@ -70,6 +70,15 @@ void BuildManager::initBindings()
 void BuildManager::initNonOfflineBuildSessions()
 {
   auto jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo);
+  jitBuildTarget->setCompileThreadCount(this->jitThreadCount);
+  jitBuildTarget->setTierUpThreshold(this->jitTierUpThreshold);
+  jitBuildTarget->setObjectCacheEnabled(this->jitCacheEnabled);
+  jitBuildTarget->setObjectCacheSizeLimit(this->jitCacheSizeLimit);
+  jitBuildTarget->setPerfMapEnabled(this->jitPerfMapEnabled);
+  jitBuildTarget->setJitDumpEnabled(this->jitDumpEnabled);
+  LlvmCodeGen::BuildTarget::DebugInfoLevel jitDebugInfoLevel;
+  jitDebugInfoLevel = this->jitDebugInfoLevel;
+  jitBuildTarget->setDebugInfoLevel(jitDebugInfoLevel);
   auto jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     this->rootManager, jitBuildTarget.get(), false
   );
@@ -80,6 +89,11 @@ void BuildManager::initNonOfflineBuildSessions()
   this->jitBuildSession->getExtraDataAccessor()->setIdPrefix("jit");
 
   auto preprocessBuildTarget = newSrdObj<LlvmCodeGen::LazyJitBuildTarget>(this->globalItemRepo);
+  preprocessBuildTarget->setCompileThreadCount(this->jitThreadCount);
+  preprocessBuildTarget->setObjectCacheEnabled(this->jitCacheEnabled);
+  preprocessBuildTarget->setObjectCacheSizeLimit(this->jitCacheSizeLimit);
+  preprocessBuildTarget->setPerfMapEnabled(this->jitPerfMapEnabled);
+  preprocessBuildTarget->setJitDumpEnabled(this->jitDumpEnabled);
   auto preprocessTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     jitTargetGenerator.get(), preprocessBuildTarget.get(), true
   );
@@ -91,12 +105,51 @@ void BuildManager::initNonOfflineBuildSessions()
 }
 
 
+void BuildManager::setJitThreadCount(Word count)
+{
+  this->jitThreadCount = count;
+  this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->setCompileThreadCount(count);
+  this->preprocessBuildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>()->setCompileThreadCount(
+    count
+  );
+}
+
+
+void BuildManager::setJitTierUpThreshold(Word threshold)
+{
+  this->jitTierUpThreshold = threshold;
+  // Preprocess code is short lived and compiled lazily, so only the main JIT session is tiered.
+  this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->setTierUpThreshold(threshold);
+}
+
+
+void BuildManager::setJitCacheEnabled(Bool enabled)
+{
+  this->jitCacheEnabled = enabled;
+  this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->setObjectCacheEnabled(enabled);
+  this->preprocessBuildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>()->setObjectCacheEnabled(
+    enabled
+  );
+}
+
+
+void BuildManager::setJitCacheSizeLimit(Word limit)
+{
+  this->jitCacheSizeLimit = limit;
+  this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->setObjectCacheSizeLimit(limit);
+  this->preprocessBuildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>()->setObjectCacheSizeLimit(
+    limit
+  );
+}
+
+
 SharedPtr<BuildSession> BuildManager::createOfflineBuildSession(Char const *targetTriple)
 {
   static LongInt idPrefixCounter(0);
   ++idPrefixCounter;
   auto buildTarget = newSrdObj<LlvmCodeGen::OfflineBuildTarget>();
   buildTarget->setTargetTriple(targetTriple);
+  buildTarget->setCodeGenThreadCount(this->codeGenThreadCount);
   auto targetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     this->jitBuildSession->getTargetGenerator().get(), buildTarget.get(), false
   );
@@ -433,7 +486,7 @@ Bool BuildManager::buildGlobalCtorOrDtor(
 }
 
 
-void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
+void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element, Array<Str> const *flags)
 {
   VALIDATE_NOT_NULL(element);
   PREPARE_SELF(buildMgr, BuildManager);
@@ -442,6 +495,7 @@ void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
   if (element->isDerivedFrom<Ast::Module>()) globalFuncElement = element;
 
   SharedPtr<BuildSession> buildSession = buildMgr->prepareBuild(BuildManager::BuildType::OFFLINE, 0, globalFuncElement);
+  buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>()->setCodeGenFlags(flags);
   auto result = buildMgr->addElementToBuild(element, buildSession.get());
   if (!buildMgr->finalizeBuild(globalFuncElement, buildSession.get())) result = false;
 
@@ -472,7 +526,8 @@ void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
 
 
 Bool BuildManager::_buildObjectFileForElement(
-  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Array<Str> const *flags, Array<Str> *objectFilenames
 ) {
   VALIDATE_NOT_NULL(element);
   PREPARE_SELF(buildMgr, BuildManager);
@@ -483,6 +538,7 @@ Bool BuildManager::_buildObjectFileForElement(
   SharedPtr<BuildSession> buildSession = buildMgr->prepareBuild(
     BuildManager::BuildType::OFFLINE, targetTriple, globalFuncElement
   );
+  buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>()->setCodeGenFlags(flags);
   auto result = buildMgr->addElementToBuild(element, buildSession.get());
   if (!buildMgr->finalizeBuild(globalFuncElement, buildSession.get())) result = false;
 
@@ -494,7 +550,7 @@ Bool BuildManager::_buildObjectFileForElement(
     Array<Str> globalCtorNames = BuildManager::getGlobalCtorNames(buildSession->getDepsInfo().get());
     Array<Str> globalDtorNames = BuildManager::getGlobalDtorNames(buildSession->getDepsInfo().get());
     buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>()->generateObjectFile(
-      objectFilename, &globalCtorNames, &globalDtorNames
+      objectFilename, &globalCtorNames, &globalDtorNames, objectFilenames
     );
   }
 
@@ -53,6 +53,30 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: Int funcNameIndex = 0;
 
+  /// The number of threads to use when generating object files for offline builds.
+  private: Word codeGenThreadCount = 1;
+
+  /// The number of threads the JIT engines use for compiling code.
+  private: Word jitThreadCount = 0;
+
+  /// The number of calls after which JIT functions get fully optimized. Zero disables tiered compilation.
+  private: Word jitTierUpThreshold = 0;
+
+  /// Whether the JIT engines keep compiled objects in an on-disk cache.
+  private: Bool jitCacheEnabled = true;
+
+  /// The maximum size in bytes of the on-disk JIT cache.
+  private: Word jitCacheSizeLimit = 512 * 1024 * 1024;
+
+  /// Whether the JIT engines write the names of compiled functions to a perf map file.
+  private: Bool jitPerfMapEnabled = false;
+
+  /// Whether the JIT engines write compiled code to a jitdump file.
+  private: Bool jitDumpEnabled = false;
+
+  /// The level of debug info generated for JIT code: 0 for none, 1 for line tables only, and 2 for full.
+  private: Int jitDebugInfoLevel = 0;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -66,7 +90,13 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
     rootManager(rm),
     astHelper(helper),
     generator(gen),
-    globalItemRepo(globalItemRepo)
+    globalItemRepo(globalItemRepo),
+    jitThreadCount(rm->getJitThreadCount()),
+    jitTierUpThreshold(rm->getJitTierUpThreshold()),
+    jitCacheEnabled(rm->isJitCacheEnabled()),
+    jitPerfMapEnabled(rm->isJitPerfMapEnabled()),
+    jitDumpEnabled(rm->isJitDumpEnabled()),
+    jitDebugInfoLevel(rm->getJitDebugInfoLevel())
   {
     this->addDynamicInterface(newSrdObj<Executing>(this));
     this->addDynamicInterface(newSrdObj<ExpressionComputation>(this));
@@ -85,6 +115,14 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
     this->rootManager = parent->getRootManager();
     this->astHelper = parent->getAstHelper();
     this->generator = parent->getGenerator();
+    this->codeGenThreadCount = parent->getCodeGenThreadCount();
+    this->jitThreadCount = parent->getJitThreadCount();
+    this->jitTierUpThreshold = parent->getJitTierUpThreshold();
+    this->jitCacheEnabled = parent->isJitCacheEnabled();
+    this->jitCacheSizeLimit = parent->getJitCacheSizeLimit();
+    this->jitPerfMapEnabled = parent->isJitPerfMapEnabled();
+    this->jitDumpEnabled = parent->isJitDumpEnabled();
+    this->jitDebugInfoLevel = parent->getJitDebugInfoLevel();
 
     this->initNonOfflineBuildSessions();
   }
@@ -118,6 +156,59 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
     return this->generator;
   }
 
+  public: void setCodeGenThreadCount(Word count)
+  {
+    this->codeGenThreadCount = count;
+  }
+
+  public: Word getCodeGenThreadCount() const
+  {
+    return this->codeGenThreadCount;
+  }
+
+  public: void setJitThreadCount(Word count);
+
+  public: Word getJitThreadCount() const
+  {
+    return this->jitThreadCount;
+  }
+
+  public: void setJitTierUpThreshold(Word threshold);
+
+  public: Word getJitTierUpThreshold() const
+  {
+    return this->jitTierUpThreshold;
+  }
+
+  public: void setJitCacheEnabled(Bool enabled);
+
+  public: Bool isJitCacheEnabled() const
+  {
+    return this->jitCacheEnabled;
+  }
+
+  public: void setJitCacheSizeLimit(Word limit);
+
+  public: Word getJitCacheSizeLimit() const
+  {
+    return this->jitCacheSizeLimit;
+  }
+
+  public: Bool isJitPerfMapEnabled() const
+  {
+    return this->jitPerfMapEnabled;
+  }
+
+  public: Bool isJitDumpEnabled() const
+  {
+    return this->jitDumpEnabled;
+  }
+
+  public: Int getJitDebugInfoLevel() const
+  {
+    return this->jitDebugInfoLevel;
+  }
+
   /// @}
 
   /// @name Code Generation Functions
@@ -154,12 +245,15 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
     )> varOpCallback
   );
 
-  public: METHOD_BINDING_CACHE(dumpLlvmIrForElement, void, (TiObject*));
-  public: static void _dumpLlvmIrForElement(TiObject *self, TiObject *element);
+  public: METHOD_BINDING_CACHE(dumpLlvmIrForElement, void, (TiObject*, Array<Str> const* /* flags */));
+  public: static void _dumpLlvmIrForElement(TiObject *self, TiObject *element, Array<Str> const *flags);
 
-  public: METHOD_BINDING_CACHE(buildObjectFileForElement, Bool, (TiObject*, Char const*, Char const*));
+  public: METHOD_BINDING_CACHE(buildObjectFileForElement,
+    Bool, (TiObject*, Char const*, Char const*, Array<Str> const* /* flags */, Array<Str>* /* objectFilenames */)
+  );
   public: static Bool _buildObjectFileForElement(
-    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Array<Str> const *flags, Array<Str> *objectFilenames
   );
 
   public: METHOD_BINDING_CACHE(resetBuild, void, (BuildSession*));
@@ -26,7 +26,8 @@ void CommandGenerator::initBindingCaches()
     &this->generateWhileStatement,
     &this->generateForStatement,
     &this->generateContinueStatement,
-    &this->generateBreakStatement
+    &this->generateBreakStatement,
+    &this->generateFenceStatement
   });
 }
 
@@ -39,6 +40,7 @@ void CommandGenerator::initBindings()
   this->generateForStatement = &CommandGenerator::_generateForStatement;
   this->generateContinueStatement = &CommandGenerator::_generateContinueStatement;
   this->generateBreakStatement = &CommandGenerator::_generateBreakStatement;
+  this->generateFenceStatement = &CommandGenerator::_generateFenceStatement;
 }
 
 
@@ -60,10 +62,21 @@ Bool CommandGenerator::_generateReturnStatement(
 
   auto operand = astNode->getOperand().get();
   if (operand != 0) {
-    // Generate the expression to return.
+    // Generate the expression to return. Values that need initialization can be generated directly in the return
+    // slot instead of a temp var.
+    Bool useReturnSlot = retType->getInitializationMethod(
+      cmdGenerator->astHelper, session->getExecutionContext()
+    ) != Ast::TypeInitMethod::NONE;
+    if (useReturnSlot) {
+      session->setResultSlot(
+        operand, retType, getSharedPtr(session->getEda()->getCodeGenData<TiObject>(retTypeRef))
+      );
+    }
     TerminalStatement terminal;
     GenResult operandResult;
-    if (!g->generateExpression(operand, session, operandResult, terminal)) return false;
+    Bool generated = g->generateExpression(operand, session, operandResult, terminal);
+    if (useReturnSlot) session->setResultSlot(0, 0, TioSharedPtr());
+    if (!generated) return false;
     if (terminal == TerminalStatement::YES) {
       cmdGenerator->astHelper->getNoticeStore()->add(
         newSrdObj<Spp::Notices::UnexpectedTerminalStatementNotice>(Core::Data::Ast::findSourceLocation(operand))
@@ -71,9 +84,7 @@ Bool CommandGenerator::_generateReturnStatement(
       return false;
     }
     // Generate the return statement.
-    if (retType->getInitializationMethod(
-      cmdGenerator->astHelper, session->getExecutionContext()
-    ) != Ast::TypeInitMethod::NONE) {
+    if (useReturnSlot) {
       // Assign value to ret reference.
       TiObject *retTgType;
       if (!g->getGeneratedType(retType, session, retTgType, 0)) return false;
@@ -84,18 +95,39 @@ Bool CommandGenerator::_generateReturnStatement(
       initTgVals.add(operandResult.targetData);
       initAstTypes.add(operandResult.astType);
       initAstNodes.add(ti_cast<Core::Data::Node>(operand));
-      if (!g->generateVarInitialization(
-        retType, session->getEda()->getCodeGenData<TiObject>(retTypeRef), astNode,
-        &initAstNodes, &initAstTypes, &initTgVals, session
-      )) {
-        return false;
+      TiObject *varAstNode = 0;
+      if (operand->isDerivedFrom<Core::Data::Ast::Identifier>()) {
+        if (!cmdGenerator->astHelper->getSeeker()->tryGet(operand, astNode->getOwner(), varAstNode)) varAstNode = 0;
+      }
+      // A local var that is returned directly is about to be destroyed, so it can be moved into the return value.
+      // The var keeps its destructor on other paths, so we only mark it for the duration of this statement.
+      DestructionNode *retVarNode = 0;
+      Bool retVarHasDestructor = false;
+      if (varAstNode != 0) {
+        auto tgVar = session->getEda()->tryGetCodeGenData<TiObject>(varAstNode);
+        retVarNode = session->getDestructionStack()->findItemByVar(tgVar);
+        if (retVarNode != 0 && retVarNode->hasDestructor) {
+          retVarHasDestructor = retVarNode->hasDestructor;
+          retVarNode->tgMovableRef = operandResult.targetData;
+        } else {
+          retVarNode = 0;
+        }
+      }
+      // The returned value could already be constructed in the return slot, in which case there is nothing to copy.
+      auto tgRetRef = session->getEda()->getCodeGenData<TiObject>(retTypeRef);
+      if (operandResult.targetData.get() != tgRetRef) {
+        if (!g->generateVarInitialization(
+          retType, tgRetRef, astNode, &initAstNodes, &initAstTypes, &initTgVals, session
+        )) {
+          return false;
+        }
+      }
+      // Destruct variables and return.
+      if (!g->generateFunctionReturn(session, retType, 0)) return false;
+      if (retVarNode != 0) {
+        retVarNode->hasDestructor = retVarHasDestructor;
+        retVarNode->tgMovableRef.reset();
       }
-      // Destruct variables.
-      if (!g->generateVarGroupDestruction(session, 0)) return false;
-      // Return
-      session->getTg()->generateReturn(
-        session->getTgContext(), session->getEda()->getCodeGenData<TiObject>(retType), 0
-      );
     } else {
       // Return the value itself.
 
@@ -109,12 +141,8 @@ Bool CommandGenerator::_generateReturnStatement(
         );
         return false;
       }
-      // Destruct variables.
-      if (!g->generateVarGroupDestruction(session, 0)) return false;
-      // Return
-      session->getTg()->generateReturn(
-        session->getTgContext(), session->getEda()->getCodeGenData<TiObject>(retType), castedValue.targetData.get()
-      );
+      // Destruct variables and return.
+      if (!g->generateFunctionReturn(session, retType, castedValue.targetData.get())) return false;
     }
   } else {
     // Make sure return type is void.
@@ -124,10 +152,8 @@ Bool CommandGenerator::_generateReturnStatement(
       );
       return false;
     }
-    // Destruct variables.
-    if (!g->generateVarGroupDestruction(session, 0)) return false;
-    // Generate a void return statement.
-    session->getTg()->generateReturn(session->getTgContext(), session->getEda()->getCodeGenData<TiObject>(retType), 0);
+    // Destruct variables and generate a void return statement.
+    if (!g->generateFunctionReturn(session, retType, 0)) return false;
   }
 
   return true;
@@ -211,6 +237,11 @@ Bool CommandGenerator::_generateWhileStatement(
   TerminalStatement terminal;
   if (!g->generateStatementBlock(body, &bodySession, terminal)) return false;
 
+  // Apply optimization hints.
+  if (astNode->getModifiers() != 0) {
+    if (!cmdGenerator->generateLoopHints(astNode->getModifiers().get(), loopTgContext.get(), session)) return false;
+  }
+
   return session->getTg()->finishWhileStatement(
     session->getTgContext(), loopTgContext.get(), conditionResult.targetData.get()
   );
@@ -270,6 +301,11 @@ Bool CommandGenerator::_generateForStatement(
   }
   if (!g->generateStatementBlock(body, &bodySession, terminal)) return false;
 
+  // Apply optimization hints.
+  if (astNode->getModifiers() != 0) {
+    if (!cmdGenerator->generateLoopHints(astNode->getModifiers().get(), loopTgContext.get(), session)) return false;
+  }
+
   return session->getTg()->finishForStatement(
     session->getTgContext(), loopTgContext.get(), conditionResult.targetData.get()
   );
@@ -374,6 +410,26 @@ Bool CommandGenerator::_generateBreakStatement(
 }
 
 
+Bool CommandGenerator::_generateFenceStatement(
+  TiObject *self, Spp::Ast::FenceStatement *astNode, Generation *g, Session *session
+) {
+  PREPARE_SELF(cmdGenerator, CommandGenerator);
+
+  // A relaxed fence has no effect, so it's rejected along with unknown orderings.
+  AtomicOrdering ordering = AtomicOrdering::SEQ_CST;
+  if (astNode->getOrdering() != 0) {
+    if (!getAtomicOrdering(astNode->getOrdering().get(), ordering) || ordering == AtomicOrdering::RELAXED) {
+      cmdGenerator->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::InvalidAtomicOrderingNotice>(astNode->findSourceLocation())
+      );
+      return false;
+    }
+  }
+
+  return session->getTg()->generateFence(session->getTgContext(), ordering);
+}
+
+
 //==============================================================================
 // Helper Functions
 
@@ -425,4 +481,49 @@ Bool CommandGenerator::castCondition(
   return true;
 }
 
+
+Bool CommandGenerator::generateLoopHints(
+  Core::Data::Ast::List *modifiers, LoopTgContext *loopTgContext, Session *session
+) {
+  Word hints = 0;
+  Word unrollCount = 0;
+  Word vectorizeWidth = 0;
+  for (Int i = 0; i < modifiers->getElementCount(); ++i) {
+    auto modifier = modifiers->getElement(i);
+    // Modifiers are either identifiers or identifiers with a single integer param, like `@unroll[4]`.
+    Core::Data::Ast::Identifier *identifier = ti_cast<Core::Data::Ast::Identifier>(modifier);
+    Core::Data::Ast::IntegerLiteral *param = 0;
+    if (identifier == 0) {
+      auto paramPass = ti_cast<Core::Data::Ast::ParamPass>(modifier);
+      if (paramPass == 0) continue;
+      identifier = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+      param = paramPass->getParam().ti_cast_get<Core::Data::Ast::IntegerLiteral>();
+      if (identifier == 0 || param == 0 || std::stoi(param->getValue().get()) <= 0) {
+        this->astHelper->getNoticeStore()->add(
+          newSrdObj<Spp::Notices::InvalidModifierDataNotice>(Core::Data::Ast::findSourceLocation(modifier))
+        );
+        return false;
+      }
+    }
+
+    auto &keyword = identifier->getValue();
+    Word value = param == 0 ? 0 : std::stoi(param->getValue().get());
+    if (keyword == S("unroll")) {
+      hints = (hints | LoopHint::UNROLL) & ~LoopHint::NO_UNROLL;
+      unrollCount = value;
+    } else if (keyword == S("no_unroll")) {
+      hints = (hints | LoopHint::NO_UNROLL) & ~LoopHint::UNROLL;
+    } else if (keyword == S("vectorize")) {
+      hints = (hints | LoopHint::VECTORIZE) & ~LoopHint::NO_VECTORIZE;
+      vectorizeWidth = value;
+    } else if (keyword == S("no_vectorize")) {
+      hints = (hints | LoopHint::NO_VECTORIZE) & ~LoopHint::VECTORIZE;
+    } else if (keyword == S("parallel_safe")) {
+      hints |= LoopHint::PARALLEL_SAFE;
+    }
+  }
+  if (hints == 0) return true;
+  return session->getTg()->generateLoopHints(loopTgContext, hints, unrollCount, vectorizeWidth);
+}
+
 } } // namespace
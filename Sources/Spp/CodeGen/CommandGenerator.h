@@ -136,6 +136,15 @@ class CommandGenerator : public TiObject, public DynamicBinding, public DynamicI
     TiObject *self, Spp::Ast::BreakStatement *astNode, Generation *g, Session *session
   );
 
+  public: METHOD_BINDING_CACHE(generateFenceStatement,
+    Bool, (
+      Spp::Ast::FenceStatement* /* astNode */, Generation* /* g */, Session* /* session */
+    )
+  );
+  private: static Bool _generateFenceStatement(
+    TiObject *self, Spp::Ast::FenceStatement *astNode, Generation *g, Session *session
+  );
+
   /// @}
 
   /// @name Helper Functions
@@ -148,6 +157,10 @@ class CommandGenerator : public TiObject, public DynamicBinding, public DynamicI
     TiObject *tgValue, TioSharedPtr &result
   );
 
+  private: Bool generateLoopHints(
+    Core::Data::Ast::List *modifiers, LoopTgContext *loopTgContext, Session *session
+  );
+
   /// @}
 
 }; // class
@@ -23,6 +23,11 @@ class DestructionNode : public TiObject
   Core::Data::Node *astNode;
   Ast::Type *astType;
   TioSharedPtr tgVar;
+  Bool hasDestructor;
+  /// Reference to the var if it holds an expiring value that can be moved out instead of copied.
+  TioSharedPtr tgMovableRef;
+  /// The shared block that destructs this var on the way out of the function, if one was generated.
+  TioSharedPtr tgCleanupContext;
 };
 
 } // namespace
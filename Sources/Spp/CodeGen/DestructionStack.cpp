@@ -34,4 +34,24 @@ Int DestructionStack::getScopeStartIndex(Int scope) const
   return this->scopeIndexes[scope];
 }
 
+
+DestructionNode* DestructionStack::findMovableItem(TiObject *tgRef) const
+{
+  if (tgRef == 0) return 0;
+  for (Int i = this->items.getCount() - 1; i >= 0; --i) {
+    if (this->items.get(i)->tgMovableRef.get() == tgRef) return this->items.get(i).get();
+  }
+  return 0;
+}
+
+
+DestructionNode* DestructionStack::findItemByVar(TiObject *tgVar) const
+{
+  if (tgVar == 0) return 0;
+  for (Int i = this->items.getCount() - 1; i >= 0; --i) {
+    if (this->items.get(i)->tgVar.get() == tgVar) return this->items.get(i).get();
+  }
+  return 0;
+}
+
 } // namespace
@@ -30,6 +30,11 @@ class DestructionStack : public TiObject
   private: SharedList<DestructionNode> items;
   private: std::vector<Int> scopeIndexes;
 
+  /// The block that all return statements of the function end at after going through the cleanup blocks.
+  private: TioSharedPtr tgReturnContext;
+  private: TioSharedPtr tgRetValVar;
+  private: Word returnCount = 0;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -66,6 +71,36 @@ class DestructionStack : public TiObject
     return this->items.getCount();
   }
 
+  public: void markLastItemMovable(TioSharedPtr const &tgRef)
+  {
+    this->items.get(this->items.getCount() - 1)->tgMovableRef = tgRef;
+  }
+
+  public: DestructionNode* findMovableItem(TiObject *tgRef) const;
+
+  public: DestructionNode* findItemByVar(TiObject *tgVar) const;
+
+  public: void setTgReturnContext(TioSharedPtr const &context, TioSharedPtr const &retValVar)
+  {
+    this->tgReturnContext = context;
+    this->tgRetValVar = retValVar;
+  }
+
+  public: TiObject* getTgReturnContext() const
+  {
+    return this->tgReturnContext.get();
+  }
+
+  public: TiObject* getTgRetValVar() const
+  {
+    return this->tgRetValVar.get();
+  }
+
+  public: Word addReturn()
+  {
+    return this->returnCount++;
+  }
+
 }; // class
 
 } // namespace
@@ -50,7 +50,11 @@ void ExpressionGenerator::initBindingCaches()
     &this->generateSizeOp,
     &this->generateInitOp,
     &this->generateTerminateOp,
+    &this->generateMoveOp,
     &this->generateNextArgOp,
+    &this->generateShuffleOp,
+    &this->generateReduceOp,
+    &this->generateAtomicOp,
     &this->generateUseInOp,
     &this->generateStringLiteral,
     &this->generateCharLiteral,
@@ -104,7 +108,11 @@ void ExpressionGenerator::initBindings()
   this->generateSizeOp = &ExpressionGenerator::_generateSizeOp;
   this->generateInitOp = &ExpressionGenerator::_generateInitOp;
   this->generateTerminateOp = &ExpressionGenerator::_generateTerminateOp;
+  this->generateMoveOp = &ExpressionGenerator::_generateMoveOp;
   this->generateNextArgOp = &ExpressionGenerator::_generateNextArgOp;
+  this->generateShuffleOp = &ExpressionGenerator::_generateShuffleOp;
+  this->generateReduceOp = &ExpressionGenerator::_generateReduceOp;
+  this->generateAtomicOp = &ExpressionGenerator::_generateAtomicOp;
   this->generateUseInOp = &ExpressionGenerator::_generateUseInOp;
   this->generateStringLiteral = &ExpressionGenerator::_generateStringLiteral;
   this->generateCharLiteral = &ExpressionGenerator::_generateCharLiteral;
@@ -182,9 +190,21 @@ Bool ExpressionGenerator::_generate(
   } else if (astNode->isDerivedFrom<Spp::Ast::TerminateOp>()) {
     auto terminateOp = static_cast<Spp::Ast::TerminateOp*>(astNode);
     return expGenerator->generateTerminateOp(terminateOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::MoveOp>()) {
+    auto moveOp = static_cast<Spp::Ast::MoveOp*>(astNode);
+    return expGenerator->generateMoveOp(moveOp, g, session, result);
   } else if (astNode->isDerivedFrom<Spp::Ast::NextArgOp>()) {
     auto nextArgOp = static_cast<Spp::Ast::NextArgOp*>(astNode);
     return expGenerator->generateNextArgOp(nextArgOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::ShuffleOp>()) {
+    auto shuffleOp = static_cast<Spp::Ast::ShuffleOp*>(astNode);
+    return expGenerator->generateShuffleOp(shuffleOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::ReduceOp>()) {
+    auto reduceOp = static_cast<Spp::Ast::ReduceOp*>(astNode);
+    return expGenerator->generateReduceOp(reduceOp, g, session, result);
+  } else if (astNode->isDerivedFrom<Spp::Ast::AtomicOp>()) {
+    auto atomicOp = static_cast<Spp::Ast::AtomicOp*>(astNode);
+    return expGenerator->generateAtomicOp(atomicOp, g, session, result);
   } else if (astNode->isDerivedFrom<Spp::Ast::UseInOp>()) {
     auto useInOp = static_cast<Spp::Ast::UseInOp*>(astNode);
     return expGenerator->generateUseInOp(useInOp, g, session, result, terminal);
@@ -381,20 +401,32 @@ Bool ExpressionGenerator::_generateRoundParamPassOnCallee(
     if (session->getTgContext() != 0) {
       TiObject *tgType;
       if (!g->getGeneratedType(callee.astNode, session, tgType, &astType)) return false;
-      TioSharedPtr tgTempVar;
-      if (!g->generateTempVar(astNode, astType, session, false, tgTempVar)) return false;
-      TioSharedPtr tgTempVarRef;
-      if (!session->getTg()->generateVarReference(session->getTgContext(), tgType, tgTempVar.get(), tgTempVarRef)) {
-        return false;
+      TioSharedPtr tgResultSlot;
+      if (expGenerator->getResultSlot(astNode, astType, session, tgResultSlot)) {
+        // The object is constructed directly in the storage of the var or return value receiving it.
+        if (!g->generateVarInitialization(
+          astType, tgResultSlot.get(), astNode, paramAstNodes, paramAstTypes, paramTgValues, session
+        )) return false;
+        result.targetData = tgResultSlot;
+      } else {
+        TioSharedPtr tgTempVar;
+        if (!g->generateTempVar(astNode, astType, session, false, tgTempVar)) return false;
+        TioSharedPtr tgTempVarRef;
+        if (!session->getTg()->generateVarReference(
+          session->getTgContext(), tgType, tgTempVar.get(), tgTempVarRef
+        )) {
+          return false;
+        }
+        if (!g->generateVarInitialization(
+          astType, tgTempVarRef.get(), astNode, paramAstNodes, paramAstTypes, paramTgValues, session
+        )) return false;
+        // Register temp var for destruction.
+        g->registerDestructor(
+          astNode, astType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
+        );
+        session->getDestructionStack()->markLastItemMovable(tgTempVarRef);
+        result.targetData = tgTempVarRef;
       }
-      if (!g->generateVarInitialization(
-        astType, tgTempVarRef.get(), astNode, paramAstNodes, paramAstTypes, paramTgValues, session
-      )) return false;
-      // Register temp var for destruction.
-      g->registerDestructor(
-        astNode, astType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
-      );
-      result.targetData = tgTempVarRef;
     } else {
       astType = expGenerator->astHelper->traceType(callee.astNode);
     }
@@ -433,8 +465,11 @@ Bool ExpressionGenerator::_generateRoundParamPassOnCallee(
       return expGenerator->generateFunctionPtrCall(
         astNode, astFuncType, derefCallee.targetData.get(), tgFuncPtrType, paramTgValues, g, session, result
       );
-    } else if (contentType != 0 && contentType->isDerivedFrom<Ast::ArrayType>()) {
-      //// Reference array element.
+    } else if (
+      contentType != 0 &&
+      (contentType->isDerivedFrom<Ast::ArrayType>() || contentType->isDerivedFrom<Ast::VectorType>())
+    ) {
+      //// Reference array or vector element.
       ////
       // Get a reference to the array.
       GenResult derefCallee;
@@ -630,6 +665,29 @@ Bool ExpressionGenerator::_generateOperator(
       return false;
     }
   } else {
+    if (
+      opType == OpType::ASSIGN && paramTgValues.getCount() == 1 && session->getTgContext() != 0 &&
+      thisArg.astType != 0 && session->getDestructionStack()->findMovableItem(paramTgValues.getElement(0)) != 0
+    ) {
+      // If the assigned value is an expiring temp we can move it into the target instead of copying it.
+      GenResult target;
+      if (!expGenerator->dereferenceIfNeeded(
+        thisArg.astType, thisArg.targetData.get(), false, false, session, target
+      )) return false;
+      auto astRefType = ti_cast<Ast::ReferenceType>(target.astType);
+      if (astRefType != 0) {
+        Bool moved;
+        if (!g->moveExpiringValue(
+          astRefType->getContentType(expGenerator->astHelper), target.targetData.get(), astNode,
+          static_cast<Core::Data::Node*>(paramAstNodes.getElement(0)),
+          static_cast<Ast::Type*>(paramAstTypes.getElement(0)), paramTgValues.getElement(0), true, session, moved
+        )) return false;
+        if (moved) {
+          result = target;
+          return true;
+        }
+      }
+    }
     // We have a function or a funciton pointer to call.
     return expGenerator->generateRoundParamPassOnCallee(
       astNode, callee, thisArg, &paramTgValues, &paramAstTypes, &paramAstNodes, g, session, result
@@ -739,7 +797,12 @@ Bool ExpressionGenerator::_generateArithmeticOp(
   Ast::Type *astTargetType = 0;
   Ast::Type *astOp2CastType = 0;
 
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Vectors, or a vector and a scalar.
+    Ast::VectorType *astVectorType;
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, param1, param2, astVectorType)) return false;
+    astOp2CastType = astTargetType = astVectorType;
+  } else if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -875,7 +938,20 @@ Bool ExpressionGenerator::_generateBinaryOp(
   )) return false;
   Ast::Type *astTargetType = 0;
 
-  if (param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()) {
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Integer vectors, or an integer vector and an integer.
+    Ast::VectorType *astVectorType;
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, param1, param2, astVectorType)) return false;
+    if (!astVectorType->getContentType(expGenerator->astHelper)->isDerivedFrom<Ast::IntegerType>()) {
+      expGenerator->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(astNode->findSourceLocation())
+      );
+      return false;
+    }
+    astTargetType = astVectorType;
+  } else if (
+    param1.astType->isDerivedFrom<Ast::IntegerType>() && param2.astType->isDerivedFrom<Ast::IntegerType>()
+  ) {
     // Two integers.
     if (astNode->getType() == S(">>") || astNode->getType() == S("<<")) {
       astTargetType = static_cast<Ast::IntegerType*>(param1.astType);
@@ -985,8 +1061,15 @@ Bool ExpressionGenerator::_generateComparisonOp(
     static_cast<Ast::Type*>(paramAstTypes->get(1)), paramTgValues->getElement(1), true, false, session, param2
   )) return false;
   Ast::Type *astTargetType = 0;
-
-  if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
+  Ast::Type *astResultType = expGenerator->astHelper->getBoolType();
+
+  if (param1.astType->isDerivedFrom<Ast::VectorType>() || param2.astType->isDerivedFrom<Ast::VectorType>()) {
+    // Vectors are compared element by element, giving a vector of booleans.
+    Ast::VectorType *astVectorType;
+    if (!expGenerator->prepareVectorOperands(g, session, astNode, param1, param2, astVectorType)) return false;
+    astTargetType = astVectorType;
+    astResultType = expGenerator->astHelper->getBoolVectorType(astVectorType->getSize(expGenerator->astHelper));
+  } else if (param1.astType->isDerivedFrom<Ast::FloatType>() && param2.astType->isDerivedFrom<Ast::FloatType>()) {
     // Two floats.
     auto floatType1 = static_cast<Ast::FloatType*>(param1.astType);
     auto floatType2 = static_cast<Ast::FloatType*>(param2.astType);
@@ -1069,7 +1152,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("!=")) {
     if (session->getTgContext() != 0) {
@@ -1077,7 +1160,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">")) {
     if (session->getTgContext() != 0) {
@@ -1085,7 +1168,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S(">=")) {
     if (session->getTgContext() != 0) {
@@ -1093,7 +1176,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<")) {
     if (session->getTgContext() != 0) {
@@ -1101,7 +1184,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else if (astNode->getType() == S("<=")) {
     if (session->getTgContext() != 0) {
@@ -1109,7 +1192,7 @@ Bool ExpressionGenerator::_generateComparisonOp(
         session->getTgContext(), tgTargetType, param1.targetData.get(), param2.targetData.get(), result.targetData
       )) return false;
     }
-    result.astType = expGenerator->astHelper->getBoolType();
+    result.astType = astResultType;
     return true;
   } else {
     throw EXCEPTION(InvalidArgumentException, S("astNode"), S("Does not represent a comparison operator."));
@@ -1343,7 +1426,9 @@ Bool ExpressionGenerator::_generateUnaryValOp(
   }
 
   Ast::Type *astTargetType = 0;
-  if (param.astType->isDerivedFrom<Ast::FloatType>()) {
+  if (param.astType->isDerivedFrom<Ast::VectorType>()) {
+    astTargetType = param.astType;
+  } else if (param.astType->isDerivedFrom<Ast::FloatType>()) {
     astTargetType = static_cast<Ast::FloatType*>(param.astType);
   } else if (param.astType->isDerivedFrom<Ast::IntegerType>()) {
     auto integerType = static_cast<Ast::IntegerType*>(param.astType);
@@ -1411,9 +1496,15 @@ Bool ExpressionGenerator::_generateIntUnaryValOp(
       static_cast<Ast::Type*>(paramAstTypes->get(0)), paramTgValues->getElement(0), true, false, session, param
     )) return false;
 
-    Ast::IntegerType *astTargetType = 0;
+    Ast::Type *astTargetType = 0;
     if (param.astType->isDerivedFrom<Ast::IntegerType>()) {
       astTargetType = static_cast<Ast::IntegerType*>(param.astType);
+    } else if (
+      param.astType->isDerivedFrom<Ast::VectorType>() &&
+      static_cast<Ast::VectorType*>(param.astType)->getContentType(expGenerator->astHelper)
+        ->isDerivedFrom<Ast::IntegerType>()
+    ) {
+      astTargetType = param.astType;
     } else {
       // Error.
       expGenerator->astHelper->getNoticeStore()->add(
@@ -1561,6 +1652,13 @@ Bool ExpressionGenerator::_generatePointerOp(
       );
       return false;
     }
+    if (astFunction->isIntrinsic()) {
+      // Intrinsics don't have an address.
+      expGenerator->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::InvalidIntrinsicUsageNotice>(Core::Data::Ast::findSourceLocation(operand))
+      );
+      return false;
+    }
     // Generate a function pointer.
     if (!g->generateFunctionDecl(astFunction, session)) return false;
     session->getFuncDeps()->add(astFunction);
@@ -2070,6 +2168,77 @@ Bool ExpressionGenerator::_generateTerminateOp(
 }
 
 
+Bool ExpressionGenerator::_generateMoveOp(
+  TiObject *self, Spp::Ast::MoveOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  // Generate the operand.
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("MoveOp operand is missing."));
+  }
+  TerminalStatement terminal;
+  GenResult operandResult;
+  if (!expGenerator->generate(operand, g, session, operandResult, terminal)) return false;
+  if (operandResult.astType == 0) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidMoveOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  if (terminal == TerminalStatement::YES) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::UnexpectedTerminalStatementNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+
+  // Dereference and get content type.
+  GenResult target;
+  if (!expGenerator->dereferenceIfNeeded(
+    operandResult.astType, operandResult.targetData.get(), false, false, session, target
+  )) return false;
+  auto astRefType = ti_cast<Ast::ReferenceType>(target.astType);
+  if (astRefType == 0) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidMoveOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  Ast::Type *astContentType = astRefType->getContentType(expGenerator->astHelper);
+
+  // Prepare the source value.
+  SharedList<TiObject> paramTgValues;
+  PlainList<TiObject> paramAstTypes;
+  PlainList<TiObject> paramAstNodes;
+  auto param = astNode->getParam().get();
+  if (!expGenerator->generateParams(param, g, session, &paramAstNodes, &paramAstTypes, &paramTgValues)) {
+    return false;
+  }
+  if (paramTgValues.getCount() != 1) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::TypeMissingMatchingMoveOpNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+
+  if (session->getTgContext() != 0) {
+    auto movableNode = session->getDestructionStack()->findMovableItem(paramTgValues.getElement(0));
+    if (!g->generateVarMove(
+      astContentType, target.targetData.get(), astNode, &paramAstNodes, &paramAstTypes, &paramTgValues, session
+    )) return false;
+    // A moved out temp is left without a value, so it must not be destroyed.
+    if (movableNode != 0) {
+      movableNode->hasDestructor = false;
+      movableNode->tgMovableRef.reset();
+    }
+  }
+  result = target;
+  return true;
+}
+
+
 Bool ExpressionGenerator::_generateNextArgOp(
   TiObject *self, Spp::Ast::NextArgOp *astNode, Generation *g, Session *session, GenResult &result
 ) {
@@ -2135,6 +2304,280 @@ Bool ExpressionGenerator::_generateNextArgOp(
 }
 
 
+Bool ExpressionGenerator::_generateShuffleOp(
+  TiObject *self, Spp::Ast::ShuffleOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("ShuffleOp operand is missing."));
+  }
+
+  // A pair of vectors in round brackets is shuffled together, otherwise we have a single vector.
+  TiObject *astSrc1 = operand;
+  TiObject *astSrc2 = 0;
+  auto bracket = ti_cast<Core::Data::Ast::Bracket>(operand);
+  if (bracket != 0 && bracket->getType() == Core::Data::Ast::BracketType::ROUND) {
+    auto list = bracket->getOperand().ti_cast_get<Core::Data::Ast::List>();
+    if (list != 0) {
+      if (list->getCount() != 2) {
+        expGenerator->astHelper->getNoticeStore()->add(
+          newSrdObj<Spp::Notices::InvalidVectorOperationNotice>(astNode->findSourceLocation())
+        );
+        return false;
+      }
+      astSrc1 = list->getElement(0);
+      astSrc2 = list->getElement(1);
+    }
+  }
+
+  // Generate the source vectors.
+  GenResult src1, src2;
+  if (!expGenerator->generateVectorOperand(astSrc1, g, session, src1)) return false;
+  auto astVectorType = static_cast<Ast::VectorType*>(src1.astType);
+  if (astSrc2 != 0) {
+    if (!expGenerator->generateVectorOperand(astSrc2, g, session, src2)) return false;
+    if (!astVectorType->isIdentical(src2.astType, expGenerator->astHelper)) {
+      expGenerator->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(astNode->findSourceLocation())
+      );
+      return false;
+    }
+  }
+
+  // Prepare the indices, which must be constants within the bounds of the source vectors.
+  auto srcSize = astVectorType->getSize(expGenerator->astHelper) * (astSrc2 == 0 ? 1 : 2);
+  SharedList<TiObject> indices;
+  auto addIndex = [&](TiObject *astIndex)->Bool {
+    auto literal = ti_cast<Core::Data::Ast::IntegerLiteral>(astIndex);
+    if (literal == 0) return false;
+    auto index = std::stol(literal->getValue().get());
+    if (index < 0 || index >= (LongInt)srcSize) return false;
+    indices.add(newSrdObj<TiInt>(index));
+    return true;
+  };
+  Bool indicesValid = true;
+  auto indicesList = astNode->getIndices().ti_cast_get<Core::Data::Ast::List>();
+  if (indicesList != 0) {
+    for (Int i = 0; i < indicesList->getCount() && indicesValid; ++i) {
+      indicesValid = addIndex(indicesList->getElement(i));
+    }
+  } else {
+    indicesValid = addIndex(astNode->getIndices().get());
+  }
+  if (!indicesValid) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidVectorOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  // Generate the shuffle.
+  auto resultAstType = expGenerator->astHelper->getResizedVectorType(astVectorType, indices.getCount());
+  TiObject *resultTgType;
+  if (!g->getGeneratedType(resultAstType, session, resultTgType, 0)) return false;
+  if (session->getTgContext() != 0) {
+    if (!session->getTg()->generateVectorShuffle(
+      session->getTgContext(), src1.targetData.get(), src2.targetData.get(), &indices, result.targetData
+    )) return false;
+  }
+  result.astType = resultAstType;
+  return true;
+}
+
+
+Bool ExpressionGenerator::_generateReduceOp(
+  TiObject *self, Spp::Ast::ReduceOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("ReduceOp operand is missing."));
+  }
+  GenResult src;
+  if (!expGenerator->generateVectorOperand(operand, g, session, src)) return false;
+  auto astVectorType = static_cast<Ast::VectorType*>(src.astType);
+  auto astElementType = astVectorType->getContentType(expGenerator->astHelper);
+  auto isInteger = astElementType->isDerivedFrom<Ast::IntegerType>();
+
+  // Determine the requested operation. Bitwise operations are only valid on integers.
+  CodeGen::VectorReduction op;
+  Bool opValid = true;
+  auto identifier = astNode->getOperation().ti_cast_get<Core::Data::Ast::Identifier>();
+  if (identifier == 0) opValid = false;
+  else {
+    auto &opName = identifier->getValue();
+    if (opName == S("add") || opName == S("جمع")) op = CodeGen::VectorReduction::ADD;
+    else if (opName == S("mul") || opName == S("ضرب")) op = CodeGen::VectorReduction::MUL;
+    else if (opName == S("min") || opName == S("أصغر")) op = CodeGen::VectorReduction::MIN;
+    else if (opName == S("max") || opName == S("أكبر")) op = CodeGen::VectorReduction::MAX;
+    else if (isInteger && (opName == S("bit_and") || opName == S("و_بتي"))) op = CodeGen::VectorReduction::AND;
+    else if (isInteger && (opName == S("bit_or") || opName == S("أو_بتي"))) op = CodeGen::VectorReduction::OR;
+    else if (isInteger && (opName == S("bit_xor") || opName == S("أو_حصري_بتي"))) {
+      op = CodeGen::VectorReduction::XOR;
+    } else opValid = false;
+  }
+  if (!opValid) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidVectorOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  // Generate the reduction.
+  if (session->getTgContext() != 0) {
+    TiObject *tgVectorType;
+    if (!g->getGeneratedType(astVectorType, session, tgVectorType, 0)) return false;
+    if (!session->getTg()->generateVectorReduction(
+      session->getTgContext(), tgVectorType, op, src.targetData.get(), result.targetData
+    )) return false;
+  }
+  result.astType = astElementType;
+  return true;
+}
+
+
+Bool ExpressionGenerator::_generateAtomicOp(
+  TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+
+  // Generate the operand, which must be a variable of an integer or pointer type.
+  auto operand = astNode->getOperand().get();
+  if (operand == 0) {
+    throw EXCEPTION(GenericException, S("AtomicOp operand is missing."));
+  }
+  TerminalStatement terminal;
+  GenResult operandResult;
+  if (!expGenerator->generate(operand, g, session, operandResult, terminal)) return false;
+  if (terminal == TerminalStatement::YES) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::UnexpectedTerminalStatementNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+  GenResult target;
+  if (operandResult.astType != 0 && !expGenerator->dereferenceIfNeeded(
+    operandResult.astType, operandResult.targetData.get(), false, false, session, target
+  )) return false;
+  auto astRefType = ti_cast<Ast::ReferenceType>(target.astType);
+  Ast::Type *astContentType = astRefType == 0 ? 0 : astRefType->getContentType(expGenerator->astHelper);
+  Bool isInteger = false;
+  if (astContentType != 0 && astContentType->isDerivedFrom<Ast::IntegerType>()) {
+    // Atomic accesses are only possible on integers of power of two byte sizes.
+    auto bitCount = static_cast<Ast::IntegerType*>(astContentType)->getBitCount(
+      expGenerator->astHelper, session->getExecutionContext()
+    );
+    isInteger = bitCount >= 8 && (bitCount & (bitCount - 1)) == 0;
+    if (!isInteger) astContentType = 0;
+  } else if (astContentType != 0 && !astContentType->isDerivedFrom<Ast::PointerType>()) {
+    astContentType = 0;
+  }
+  if (astContentType == 0) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperandNotice>(Core::Data::Ast::findSourceLocation(operand))
+    );
+    return false;
+  }
+
+  // Determine the requested operation, which is followed by its values then an optional memory ordering.
+  PlainList<TiObject> params;
+  auto paramsList = astNode->getParams().ti_cast_get<Core::Data::Ast::List>();
+  if (paramsList != 0) {
+    for (Int i = 0; i < paramsList->getCount(); ++i) params.add(paramsList->getElement(i));
+  } else if (astNode->getParams() != 0) {
+    params.add(astNode->getParams().get());
+  }
+  enum class Kind { LOAD, STORE, RMW, CMPXCHG };
+  Kind kind = Kind::LOAD;
+  AtomicOperation op;
+  Int valueCount = 1;
+  auto identifier = params.getCount() > 0 ? ti_cast<Core::Data::Ast::Identifier>(params.get(0)) : 0;
+  Bool opValid = identifier != 0;
+  if (opValid) {
+    auto &opName = identifier->getValue();
+    if (opName == S("load") || opName == S("حمل")) { kind = Kind::LOAD; valueCount = 0; }
+    else if (opName == S("store") || opName == S("خزن")) kind = Kind::STORE;
+    else if (opName == S("cmpxchg") || opName == S("قارن_بادل")) { kind = Kind::CMPXCHG; valueCount = 2; }
+    else {
+      kind = Kind::RMW;
+      if (opName == S("xchg") || opName == S("بادل")) op = AtomicOperation::XCHG;
+      else if (!isInteger) opValid = false;
+      else if (opName == S("add") || opName == S("جمع")) op = AtomicOperation::ADD;
+      else if (opName == S("sub") || opName == S("طرح")) op = AtomicOperation::SUB;
+      else if (opName == S("bit_and") || opName == S("و_بتي")) op = AtomicOperation::AND;
+      else if (opName == S("bit_or") || opName == S("أو_بتي")) op = AtomicOperation::OR;
+      else if (opName == S("bit_xor") || opName == S("أو_حصري_بتي")) op = AtomicOperation::XOR;
+      else if (opName == S("min") || opName == S("أصغر")) op = AtomicOperation::MIN;
+      else if (opName == S("max") || opName == S("أكبر")) op = AtomicOperation::MAX;
+      else opValid = false;
+    }
+  }
+  if (!opValid || (params.getCount() != valueCount + 1 && params.getCount() != valueCount + 2)) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidAtomicOperationNotice>(astNode->findSourceLocation())
+    );
+    return false;
+  }
+
+  // Loads can't release and stores can't acquire.
+  AtomicOrdering ordering = AtomicOrdering::SEQ_CST;
+  if (params.getCount() == valueCount + 2) {
+    auto astOrdering = params.get(valueCount + 1);
+    Bool orderingValid = getAtomicOrdering(astOrdering, ordering);
+    if (kind == Kind::LOAD) {
+      orderingValid = orderingValid && ordering != AtomicOrdering::RELEASE && ordering != AtomicOrdering::ACQ_REL;
+    } else if (kind == Kind::STORE) {
+      orderingValid = orderingValid && ordering != AtomicOrdering::ACQUIRE && ordering != AtomicOrdering::ACQ_REL;
+    }
+    if (!orderingValid) {
+      expGenerator->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::InvalidAtomicOrderingNotice>(Core::Data::Ast::findSourceLocation(astOrdering))
+      );
+      return false;
+    }
+  }
+
+  // Prepare the values.
+  TioSharedPtr tgValues[2];
+  for (Int i = 0; i < valueCount; ++i) {
+    if (!expGenerator->prepareAtomicValue(params.get(i + 1), astContentType, g, session, tgValues[i])) return false;
+  }
+
+  // Generate the operation.
+  if (session->getTgContext() != 0) {
+    TiObject *tgContentType;
+    if (!g->getGeneratedType(astContentType, session, tgContentType, 0)) return false;
+    Bool retVal;
+    if (kind == Kind::LOAD) {
+      retVal = session->getTg()->generateAtomicLoad(
+        session->getTgContext(), tgContentType, target.targetData.get(), ordering, result.targetData
+      );
+    } else if (kind == Kind::STORE) {
+      retVal = session->getTg()->generateAtomicStore(
+        session->getTgContext(), tgContentType, tgValues[0].get(), target.targetData.get(), ordering
+      );
+    } else if (kind == Kind::RMW) {
+      retVal = session->getTg()->generateAtomicRmw(
+        session->getTgContext(), tgContentType, op, tgValues[0].get(), target.targetData.get(), ordering,
+        result.targetData
+      );
+    } else {
+      retVal = session->getTg()->generateAtomicCmpXchg(
+        session->getTgContext(), tgContentType, tgValues[0].get(), tgValues[1].get(), target.targetData.get(),
+        ordering, result.targetData
+      );
+    }
+    if (!retVal) return false;
+  }
+  if (kind == Kind::STORE) result.astType = expGenerator->astHelper->getVoidType();
+  else result.astType = astContentType;
+  return true;
+}
+
+
 Bool ExpressionGenerator::_generateUseInOp(
   TiObject *self, Spp::Ast::UseInOp *astNode, Generation *g, Session *session, GenResult &result,
   TerminalStatement &terminal
@@ -2176,6 +2619,10 @@ Bool ExpressionGenerator::_generateUseInOp(
     return true;
   }
 
+  // The body can refer to the operand after any statement, so it can no longer be moved out.
+  auto movableNode = session->getDestructionStack()->findMovableItem(result.targetData.get());
+  if (movableNode != 0) movableNode->tgMovableRef.reset();
+
   // Generate the body.
   // Make sure the reference is not an implicit reference.
   auto contentType = refType->getContentType(expGenerator->getAstHelper());
@@ -2595,13 +3042,17 @@ Bool ExpressionGenerator::_generateArrayReference(
     auto astPtrType = expGenerator->astHelper->getPointerTypeFor(astType);
     if (!g->getGeneratedType(astPtrType, session, tgArrayType, 0)) return false;
   }
-  auto astArrayType = ti_cast<Ast::ArrayType>(astType);
-  if (astArrayType == 0) {
+  // Vector elements are referenced the same way array elements are.
+  Ast::Type *astElementType;
+  if (astType->isDerivedFrom<Ast::ArrayType>()) {
+    astElementType = static_cast<Ast::ArrayType*>(astType)->getContentType(expGenerator->astHelper);
+  } else if (astType->isDerivedFrom<Ast::VectorType>()) {
+    astElementType = static_cast<Ast::VectorType*>(astType)->getContentType(expGenerator->astHelper);
+  } else {
     throw EXCEPTION(GenericException, S("Unexpected type for array reference."));
   }
 
   // Find element type.
-  auto astElementType = astArrayType->getContentType(expGenerator->astHelper);
   TiObject *tgElementType;
   if (!g->getGeneratedType(astElementType, session, tgElementType, 0)) return false;
 
@@ -2639,15 +3090,18 @@ Bool ExpressionGenerator::_generateFunctionCall(
       expGenerator->astHelper, session->getExecutionContext()
     ) != Ast::TypeInitMethod::NONE) {
       if (session->getTgContext() != 0) {
-        // Pass a reference to the return value.
+        // Pass a reference to the return value. If this call's value is going straight into a var or into the
+        // current function's return value then we pass that storage directly, otherwise we use a temp var.
         TioSharedPtr tgTempVar;
-        if (!g->generateTempVar(astNode, astRetType, session, false, tgTempVar)) return false;
         TioSharedPtr tgResult;
-        if (!session->getTg()->generateVarReference(
-          session->getTgContext(), session->getEda()->getCodeGenData<TiObject>(astRetType),
-          tgTempVar.get(), tgResult
-        )) {
-          return false;
+        if (!expGenerator->getResultSlot(astNode, astRetType, session, tgResult)) {
+          if (!g->generateTempVar(astNode, astRetType, session, false, tgTempVar)) return false;
+          if (!session->getTg()->generateVarReference(
+            session->getTgContext(), session->getEda()->getCodeGenData<TiObject>(astRetType),
+            tgTempVar.get(), tgResult
+          )) {
+            return false;
+          }
         }
         PlainList<TiObject> paramTgValuesWithRet;
         paramTgValuesWithRet.add(tgResult.get());
@@ -2658,10 +3112,13 @@ Bool ExpressionGenerator::_generateFunctionCall(
           session->getTgContext(), tgFunction, &paramTgValuesWithRet, result.targetData
         )) return false;
         result.targetData = tgResult;
-        // Register temp var for destruction.
-        g->registerDestructor(
-          astNode, astRetType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
-        );
+        if (tgTempVar != 0) {
+          // Register temp var for destruction.
+          g->registerDestructor(
+            astNode, astRetType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
+          );
+          session->getDestructionStack()->markLastItemMovable(tgResult);
+        }
       }
       result.astType = expGenerator->astHelper->getReferenceTypeFor(astRetType, Ast::ReferenceMode::IMPLICIT);
     } else {
@@ -2712,6 +3169,7 @@ Bool ExpressionGenerator::_generateFunctionPtrCall(
       g->registerDestructor(
         astNode, astRetType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
       );
+      session->getDestructionStack()->markLastItemMovable(tgResult);
     }
     result.astType = expGenerator->astHelper->getReferenceTypeFor(astRetType, Ast::ReferenceMode::IMPLICIT);
   } else {
@@ -3032,8 +3490,8 @@ Bool ExpressionGenerator::_referencifyThisIfNeeded(
   if (thisArg.astType != 0 && ti_cast<Ast::ReferenceType>(thisArg.astType) == 0) {
     if (session->getTgContext() != 0) {
       // Member functions need a reference so we'll create a temp var.
-      // This code path should not be reached with custom-initialization variables, so we don't need to
-      // register the destructor here.
+      // This code path should not be reached with custom-initialization variables, so registering the var only
+      // ends its lifetime with the enclosing scope.
       TioSharedPtr tgTempVar;
       if (!g->generateTempVar(astNode, thisArg.astType, session, false, tgTempVar)) return false;
       PlainList<TiObject> thisParamAstNodes({ astNode });
@@ -3049,6 +3507,9 @@ Bool ExpressionGenerator::_referencifyThisIfNeeded(
         thisArg.astType, thisResult.targetData.get(), astNode,
         &thisParamAstNodes, &thisParamAstTypes, &thisParamTgValues, session
       )) return false;
+      g->registerDestructor(
+        astNode, thisArg.astType, tgTempVar, session->getExecutionContext(), session->getDestructionStack()
+      );
     }
     thisResult.astType = expGenerator->astHelper->getReferenceTypeFor(
       thisArg.astType, Ast::ReferenceMode::IMPLICIT
@@ -3191,4 +3652,141 @@ Bool ExpressionGenerator::castLogicalOperand(
   return true;
 }
 
+
+Bool ExpressionGenerator::generateVectorOperand(
+  TiObject *astNode, Generation *g, Session *session, GenResult &result
+) {
+  TerminalStatement terminal;
+  GenResult operandResult;
+  if (!this->generate(astNode, g, session, operandResult, terminal)) return false;
+  if (terminal == TerminalStatement::YES) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::UnexpectedTerminalStatementNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+  if (operandResult.astType == 0) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidReferenceNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+  if (!this->dereferenceIfNeeded(
+    operandResult.astType, operandResult.targetData.get(), true, false, session, result
+  )) return false;
+  if (!result.astType->isDerivedFrom<Ast::VectorType>()) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidVectorOperationNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+  return true;
+}
+
+
+Bool ExpressionGenerator::prepareVectorOperands(
+  Generation *g, Session *session, Core::Data::Node *astNode, GenResult &param1, GenResult &param2,
+  Ast::VectorType *&astVectorType
+) {
+  auto astVectorType1 = ti_cast<Ast::VectorType>(param1.astType);
+  auto astVectorType2 = ti_cast<Ast::VectorType>(param2.astType);
+  if (astVectorType1 != 0 && astVectorType2 != 0) {
+    // Two vectors, which must be of the same type.
+    if (!astVectorType1->isIdentical(astVectorType2, this->astHelper)) {
+      this->astHelper->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(Core::Data::Ast::findSourceLocation(astNode))
+      );
+      return false;
+    }
+    astVectorType = astVectorType1;
+    return true;
+  }
+
+  // A vector and a scalar. The scalar is broadcast to all elements of the vector.
+  astVectorType = astVectorType1 != 0 ? astVectorType1 : astVectorType2;
+  auto &scalar = astVectorType1 != 0 ? param2 : param1;
+  auto astElementType = astVectorType->getContentType(this->astHelper);
+  if (
+    (!scalar.astType->isDerivedFrom<Ast::IntegerType>() && !scalar.astType->isDerivedFrom<Ast::FloatType>()) ||
+    !this->astHelper->isImplicitlyCastableTo(scalar.astType, astElementType, session->getExecutionContext())
+  ) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+
+  if (session->getTgContext() != 0) {
+    if (!g->generateCast(
+      session, scalar.astType, astElementType, astNode, scalar.targetData.get(), false, scalar
+    )) {
+      throw EXCEPTION(GenericException, S("Casting unexpectedly failed."));
+    }
+    TiObject *tgVectorType;
+    if (!g->getGeneratedType(astVectorType, session, tgVectorType, 0)) return false;
+    TioSharedPtr tgSplat;
+    if (!session->getTg()->generateVectorSplat(
+      session->getTgContext(), tgVectorType, scalar.targetData.get(), tgSplat
+    )) return false;
+    scalar.targetData = tgSplat;
+  }
+  scalar.astType = astVectorType;
+  return true;
+}
+
+
+Bool ExpressionGenerator::prepareAtomicValue(
+  TiObject *astNode, Ast::Type *astContentType, Generation *g, Session *session, TioSharedPtr &result
+) {
+  TerminalStatement terminal;
+  GenResult valueResult;
+  if (!this->generate(astNode, g, session, valueResult, terminal)) return false;
+  if (terminal == TerminalStatement::YES) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::UnexpectedTerminalStatementNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+  if (valueResult.astType == 0) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidReferenceNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+
+  // Cast the value to the type of the atomic variable.
+  Bool retVal;
+  if (session->getTgContext() != 0) {
+    GenResult castResult;
+    retVal = g->generateCast(
+      session, valueResult.astType, astContentType, ti_cast<Core::Data::Node>(astNode),
+      valueResult.targetData.get(), true, castResult
+    );
+    result = castResult.targetData;
+  } else {
+    retVal = this->astHelper->isImplicitlyCastableTo(
+      valueResult.astType, astContentType, session->getExecutionContext()
+    );
+  }
+  if (!retVal) {
+    this->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::IncompatibleOperatorTypesNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+  return true;
+}
+
+
+Bool ExpressionGenerator::getResultSlot(
+  Core::Data::Node *astNode, Ast::Type *astType, Session *session, TioSharedPtr &result
+) {
+  if (astNode == 0 || session->getAstResultSlotValue() != astNode) return false;
+  if (!astType->isEqual(session->getAstResultSlotType(), this->astHelper, session->getExecutionContext())) {
+    return false;
+  }
+  result = session->getTgResultSlot();
+  return true;
+}
+
 } // namespace
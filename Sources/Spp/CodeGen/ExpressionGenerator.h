@@ -417,6 +417,16 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *self, Spp::Ast::TerminateOp *astNode, Generation *g, Session *session, GenResult &result
   );
 
+  public: METHOD_BINDING_CACHE(generateMoveOp,
+    Bool, (
+      Spp::Ast::MoveOp* /* astNode */, Generation* /* g */,
+      Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateMoveOp(
+    TiObject *self, Spp::Ast::MoveOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
   public: METHOD_BINDING_CACHE(generateNextArgOp,
     Bool, (
       Spp::Ast::NextArgOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
@@ -426,6 +436,33 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *self, Spp::Ast::NextArgOp *astNode, Generation *g, Session *session, GenResult &result
   );
 
+  public: METHOD_BINDING_CACHE(generateShuffleOp,
+    Bool, (
+      Spp::Ast::ShuffleOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateShuffleOp(
+    TiObject *self, Spp::Ast::ShuffleOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
+  public: METHOD_BINDING_CACHE(generateReduceOp,
+    Bool, (
+      Spp::Ast::ReduceOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateReduceOp(
+    TiObject *self, Spp::Ast::ReduceOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicOp,
+    Bool, (
+      Spp::Ast::AtomicOp* /* astNode */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateAtomicOp(
+    TiObject *self, Spp::Ast::AtomicOp *astNode, Generation *g, Session *session, GenResult &result
+  );
+
   public: METHOD_BINDING_CACHE(generateUseInOp,
     Bool, (
       Spp::Ast::UseInOp* /* astNode */, Generation* /* g */,
@@ -650,6 +687,19 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     TiObject *tgValue, TioSharedPtr &result
   );
 
+  private: Bool generateVectorOperand(TiObject *astNode, Generation *g, Session *session, GenResult &result);
+
+  private: Bool prepareVectorOperands(
+    Generation *g, Session *session, Core::Data::Node *astNode, GenResult &param1, GenResult &param2,
+    Ast::VectorType *&astVectorType
+  );
+
+  private: Bool prepareAtomicValue(
+    TiObject *astNode, Ast::Type *astContentType, Generation *g, Session *session, TioSharedPtr &result
+  );
+
+  private: Bool getResultSlot(Core::Data::Node *astNode, Ast::Type *astType, Session *session, TioSharedPtr &result);
+
   /// @}
 
 }; // class
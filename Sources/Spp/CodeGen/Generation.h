@@ -45,11 +45,14 @@ class Generation : public ObjTiInterface
       &this->generateVarDef,
       &this->generateTempVar,
       &this->generateVarInitialization,
+      &this->generateVarMove,
+      &this->moveExpiringValue,
       &this->generateMemberVarInitialization,
       &this->generateVarDestruction,
       &this->generateMemberVarDestruction,
       &this->registerDestructor,
       &this->generateVarGroupDestruction,
+      &this->generateFunctionReturn,
       &this->generateStatementBlock,
       &this->generateStatement,
       &this->generateExpression,
@@ -118,6 +121,18 @@ class Generation : public ObjTiInterface
     SharedList<TiObject>* /* paramTgValues */, Session* /* session */
   ));
 
+  public: METHOD_BINDING_CACHE(generateVarMove, Bool, (
+    Spp::Ast::Type* /* varAstType */, TiObject* /* tgVarRef */, Core::Data::Node* /* astNode */,
+    PlainList<TiObject>* /* paramAstNodes */, PlainList<TiObject>* /* paramAstTypes */,
+    SharedList<TiObject>* /* paramTgValues */, Session* /* session */
+  ));
+
+  public: METHOD_BINDING_CACHE(moveExpiringValue, Bool, (
+    Spp::Ast::Type* /* varAstType */, TiObject* /* tgVarRef */, Core::Data::Node* /* astNode */,
+    Core::Data::Node* /* srcAstNode */, Spp::Ast::Type* /* srcAstType */, TiObject* /* tgSrcRef */,
+    Bool /* assign */, Session* /* session */, Bool& /* moved */
+  ));
+
   public: METHOD_BINDING_CACHE(generateMemberVarInitialization,
     Bool, (TiObject* /* astMemberNode */, Session* /* session */)
   );
@@ -144,6 +159,10 @@ class Generation : public ObjTiInterface
     Bool, (Session* /* session */, Int /* index */)
   );
 
+  public: METHOD_BINDING_CACHE(generateFunctionReturn,
+    Bool, (Session* /* session */, Ast::Type* /* astRetType */, TiObject* /* tgRetVal */)
+  );
+
   public: METHOD_BINDING_CACHE(generateStatementBlock,
     Bool, (
       TiObject* /* astBlock */, Session* /* session */,
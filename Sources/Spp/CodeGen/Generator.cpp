@@ -31,11 +31,14 @@ void Generator::initBindings()
   generation->generateVarDef = &Generator::_generateVarDef;
   generation->generateTempVar = &Generator::_generateTempVar;
   generation->generateVarInitialization = &Generator::_generateVarInitialization;
+  generation->generateVarMove = &Generator::_generateVarMove;
+  generation->moveExpiringValue = &Generator::_moveExpiringValue;
   generation->generateMemberVarInitialization = &Generator::_generateMemberVarInitialization;
   generation->generateVarDestruction = &Generator::_generateVarDestruction;
   generation->generateMemberVarDestruction = &Generator::_generateMemberVarDestruction;
   generation->registerDestructor = &Generator::_registerDestructor;
   generation->generateVarGroupDestruction = &Generator::_generateVarGroupDestruction;
+  generation->generateFunctionReturn = &Generator::_generateFunctionReturn;
   generation->generateStatementBlock = &Generator::_generateStatementBlock;
   generation->generateStatement = &Generator::_generateStatement;
   generation->generateExpression = &Generator::_generateExpression;
@@ -149,9 +152,14 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
     SharedList<TiObject> tgVars;
     TioSharedPtr tgContext;
     if (!session->getTg()->prepareFunctionBody(tgFunc, tgFuncType, &tgVars, tgContext)) return false;
+    auto astFuncSourceLocation = Core::Data::Ast::findSourceLocation(astFunc).get();
+    if (!session->getTg()->prepareFunctionDebugInfo(tgFunc, tgFuncType, tgContext.get(), astFuncSourceLocation)) {
+      return false;
+    }
 
     DestructionStack destructionStack;
     Session childSession(session, tgContext.get(), tgContext.get(), &destructionStack);
+    childSession.setAstReturnedVar(0);
 
     // Store the generated ret value reference, if needed.
     if (astRetType->getInitializationMethod(
@@ -159,6 +167,9 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
     ) != Ast::TypeInitMethod::NONE) {
       session->getEda()->setCodeGenData(astRetTypeRef, tgVars.get(0));
       tgVars.remove(0);
+      // If every return statement returns the same local var then that var can be constructed directly in the
+      // return slot, eliminating the copy and destruction at return.
+      childSession.setAstReturnedVar(generator->findReturnedLocalVar(ti_cast<Ast::Block>(astBlock)));
     }
 
     // Store the generated data.
@@ -179,6 +190,12 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
       )) {
         return false;
       }
+      if (!session->getTg()->generateVarLifetimeStart(tgContext.get(), argTgVar.get())) return false;
+      if (!session->getTg()->generateVarDebugInfo(
+        tgContext.get(), argTgVar.get(), argTgType, astArgs->getElementKey(i), i + 1, astFuncSourceLocation
+      )) {
+        return false;
+      }
       session->getEda()->setCodeGenData(argType, argTgVar);
       Ast::Type *argSourceAstType;
       if (argAstType->getInitializationMethod(
@@ -259,10 +276,45 @@ Bool Generator::_generateFunctionDecl(TiObject *self, Spp::Ast::Function *astFun
     return false;
   }
 
+  // Intrinsics are declared by the target itself and can't have a body or any attributes.
+  if (astFunc->isIntrinsic()) {
+    if (astFunc->getBody() != 0) {
+      generator->rootManager->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::InvalidIntrinsicUsageNotice>(astFunc->findSourceLocation())
+      );
+      return false;
+    }
+    TioSharedPtr tgFuncResult;
+    if (!session->getTg()->generateIntrinsicFunctionDecl(
+      astFunc->getName().get(), tgFunctionType, tgFuncResult
+    )) {
+      generator->rootManager->getNoticeStore()->add(
+        newSrdObj<Spp::Notices::InvalidIntrinsicNotice>(astFunc->findSourceLocation())
+      );
+      return false;
+    }
+    session->getEda()->setCodeGenData(astFunc, tgFuncResult);
+    return true;
+  }
+
   // Generate the function object.
   Str name = generator->astHelper->getFunctionName(astFunc);
   TioSharedPtr tgFuncResult;
   if (!session->getTg()->generateFunctionDecl(name, tgFunctionType, tgFuncResult)) return false;
+  if (astFunc->getExported() && !session->getTg()->exportFunction(tgFuncResult.get())) return false;
+
+  // Map the function's optimization modifiers to target attributes.
+  Word attributes = 0;
+  if (astFunc->getInlining() == Ast::FunctionInlining::ALWAYS) attributes |= FunctionAttribute::ALWAYS_INLINE;
+  else if (astFunc->getInlining() == Ast::FunctionInlining::NEVER) attributes |= FunctionAttribute::NO_INLINE;
+  if (astFunc->getHotness() == Ast::FunctionHotness::HOT) attributes |= FunctionAttribute::HOT;
+  else if (astFunc->getHotness() == Ast::FunctionHotness::COLD) attributes |= FunctionAttribute::COLD;
+  if (astFunc->isPure()) {
+    // We can't verify that a pure function doesn't read memory, so it's only marked as read only.
+    attributes |= FunctionAttribute::READ_ONLY | FunctionAttribute::NO_UNWIND | FunctionAttribute::WILL_RETURN;
+  }
+  if (attributes != 0 && !session->getTg()->generateFunctionAttributes(tgFuncResult.get(), attributes)) return false;
+
   session->getEda()->setCodeGenData(astFunc, tgFuncResult);
 
   // TODO: Do we need these attributes?
@@ -406,15 +458,41 @@ Bool Generator::_generateVarDef(TiObject *self, Core::Data::Ast::Definition *def
         throw EXCEPTION(GenericException, S("Missing TG allocation context."));
       }
 
+      // Is this the var returned by the function? In that case we'll use the return slot instead of a new var.
+      TiObject *tgRetRef = 0;
+      if (session->getAstReturnedVar() == astVar) {
+        auto astFuncType = Core::Data::findOwner<Ast::Function>(definition)->getType().get();
+        if (astType->isEqual(
+          astFuncType->traceRetType(generator->astHelper), generator->astHelper, session->getExecutionContext()
+        )) {
+          tgRetRef = session->getEda()->getCodeGenData<TiObject>(astFuncType->getRetType().get());
+        } else {
+          session->setAstReturnedVar(0);
+        }
+      }
+      Bool returned = tgRetRef != 0;
+
       // Create the target local var.
       TioSharedPtr tgLocalVar;
-      if (!session->getTg()->generateLocalVariable(
-        session->getTgAllocContext(), tgType, definition->getName().get(), 0, tgLocalVar)
-      ) {
-        session->getEda()->setCodeGenFailed(astVar, true);
-        return false;
+      if (returned) {
+        tgLocalVar = getSharedPtr(tgRetRef);
+        session->getEda()->setCodeGenData(astVar, tgLocalVar);
+      } else {
+        if (!session->getTg()->generateLocalVariable(
+          session->getTgAllocContext(), tgType, definition->getName().get(), 0, tgLocalVar)
+        ) {
+          session->getEda()->setCodeGenFailed(astVar, true);
+          return false;
+        }
+        session->getEda()->setCodeGenData(astVar, tgLocalVar);
+        if (!session->getTg()->generateVarLifetimeStart(session->getTgContext(), tgLocalVar.get())) return false;
+        if (!session->getTg()->generateVarDebugInfo(
+          session->getTgContext(), tgLocalVar.get(), tgType, definition->getName().get(), 0,
+          Core::Data::Ast::findSourceLocation(definition).get()
+        )) {
+          return false;
+        }
       }
-      session->getEda()->setCodeGenData(astVar, tgLocalVar);
 
       // Initialize the variable.
       // TODO: Should we use default values with local variables?
@@ -435,18 +513,25 @@ Bool Generator::_generateVarDef(TiObject *self, Core::Data::Ast::Definition *def
       PlainList<TiObject> initAstTypes;
       PlainList<TiObject> initAstNodes;
       if (astParams != 0) {
-        if (!generator->expressionGenerator->generateParams(
+        // A single value of the var's own type can be generated directly in the var's storage.
+        Bool useResultSlot = !astParams->isDerivedFrom<Core::Data::Ast::List>();
+        if (useResultSlot) session->setResultSlot(astParams, astType, tgLocalVarRef);
+        Bool generated = generator->expressionGenerator->generateParams(
           astParams, generation, session, &initAstNodes, &initAstTypes, &initTgVals
-        )) {
+        );
+        if (useResultSlot) session->setResultSlot(0, 0, TioSharedPtr());
+        if (!generated) {
           session->getDestructionStack()->popScope();
           return false;
         }
       }
-      if (!generation->generateVarInitialization(
-        astType, tgLocalVarRef.get(), definition, &initAstNodes, &initAstTypes, &initTgVals, session
-      )) {
-        session->getDestructionStack()->popScope();
-        return false;
+      if (initTgVals.getCount() != 1 || initTgVals.get(0) != tgLocalVarRef) {
+        if (!generation->generateVarInitialization(
+          astType, tgLocalVarRef.get(), definition, &initAstNodes, &initAstTypes, &initTgVals, session
+        )) {
+          session->getDestructionStack()->popScope();
+          return false;
+        }
       }
 
       if (!generation->generateVarGroupDestruction(session, session->getDestructionStack()->getScopeStartIndex(-1))) {
@@ -455,10 +540,13 @@ Bool Generator::_generateVarDef(TiObject *self, Core::Data::Ast::Definition *def
       }
       session->getDestructionStack()->popScope();
 
-      generation->registerDestructor(
-        ti_cast<Core::Data::Node>(astVar), astType, tgLocalVar,
-        session->getExecutionContext(), session->getDestructionStack()
-      );
+      // The returned var is owned by the caller, so it's never destroyed here.
+      if (!returned) {
+        generation->registerDestructor(
+          ti_cast<Core::Data::Node>(astVar), astType, tgLocalVar,
+          session->getExecutionContext(), session->getDestructionStack()
+        );
+      }
     }
   }
 
@@ -502,6 +590,7 @@ Bool Generator::_generateTempVar(
   if (!session->getTg()->generateLocalVariable(session->getTgAllocContext(), tgType, name, 0, tgVar)) {
     return false;
   }
+  if (!session->getTg()->generateVarLifetimeStart(session->getTgContext(), tgVar.get())) return false;
 
   if (initialize) {
     // Initialize the variable.
@@ -544,6 +633,16 @@ Bool Generator::_generateVarInitialization(
   if (varAstType->getInitializationMethod(
     generator->getAstHelper(), session->getExecutionContext()
   ) != Ast::TypeInitMethod::NONE) {
+    // Expiring values are moved rather than copied, if the type allows it.
+    if (paramTgValues->getCount() == 1) {
+      Bool moved;
+      if (!generation->moveExpiringValue(
+        varAstType, tgVarRef, astNode, ti_cast<Core::Data::Node>(paramAstNodes->getElement(0)),
+        static_cast<Ast::Type*>(paramAstTypes->getElement(0)), paramTgValues->getElement(0), false, session, moved
+      )) return false;
+      if (moved) return true;
+    }
+
     TiObject *tgAutoCtor;
     if (!generator->typeGenerator->getGeneratedTypeAutoCtor(varAstType, generation, session, tgAutoCtor)) return false;
     // Call automatic constructors, if any.
@@ -635,6 +734,81 @@ Bool Generator::_generateVarInitialization(
 }
 
 
+Bool Generator::_generateVarMove(
+  TiObject *self, Spp::Ast::Type *varAstType, TiObject *tgVarRef, Core::Data::Node *astNode,
+  PlainList<TiObject> *paramAstNodes, PlainList<TiObject> *paramAstTypes, SharedList<TiObject> *paramTgValues,
+  Session *session
+) {
+  PREPARE_SELF(generator, Generator);
+  PREPARE_SELF(generation, Generation);
+
+  // Unlike initialization, no automatic constructors are called here since the move op takes over the var's
+  // storage as is.
+  auto callee = generator->lookupMoveOp(varAstType, astNode, paramAstTypes, session);
+  if (callee == 0) {
+    generator->rootManager->getNoticeStore()->add(newSrdObj<Spp::Notices::TypeMissingMatchingMoveOpNotice>(
+      Core::Data::Ast::findSourceLocation(astNode)
+    ));
+    return false;
+  }
+
+  // Prepare the arguments to send.
+  auto varPtrAstType = generator->getAstHelper()->getReferenceTypeFor(varAstType, Ast::ReferenceMode::IMPLICIT);
+  paramAstNodes->insertElement(0, astNode);
+  paramAstTypes->insertElement(0, varPtrAstType);
+  paramTgValues->insertElement(0, tgVarRef);
+  if (!generator->getExpressionGenerator()->prepareFunctionParams(
+    callee->getType().get(), generation, session, paramAstNodes, paramAstTypes, paramTgValues
+  )) return false;
+
+  // Call the found move op.
+  GenResult result;
+  return generator->getExpressionGenerator()->generateFunctionCall(
+    astNode, callee, paramAstTypes, paramTgValues, generation, session, result
+  );
+}
+
+
+Bool Generator::_moveExpiringValue(
+  TiObject *self, Spp::Ast::Type *varAstType, TiObject *tgVarRef, Core::Data::Node *astNode,
+  Core::Data::Node *srcAstNode, Spp::Ast::Type *srcAstType, TiObject *tgSrcRef, Bool assign, Session *session,
+  Bool &moved
+) {
+  PREPARE_SELF(generator, Generator);
+  PREPARE_SELF(generation, Generation);
+
+  moved = false;
+
+  // Only values that are about to be destroyed can be moved, and only into vars of the same type.
+  auto node = session->getDestructionStack()->findMovableItem(tgSrcRef);
+  if (node == 0) return true;
+  auto srcContentType = generator->astHelper->tryGetDeepReferenceContentType(srcAstType);
+  if (srcContentType == 0 || !srcContentType->isEqual(varAstType, generator->astHelper, session->getExecutionContext())) {
+    return true;
+  }
+  PlainList<TiObject> paramAstTypes({ srcAstType });
+  if (generator->lookupMoveOp(varAstType, astNode, &paramAstTypes, session) == 0) return true;
+
+  // When assigning, the old value of the var is destroyed first since the move op expects raw storage.
+  if (assign) {
+    if (!generation->generateVarDestruction(varAstType, tgVarRef, astNode, session)) return false;
+  }
+
+  PlainList<TiObject> paramAstNodes({ srcAstNode });
+  SharedList<TiObject> paramTgValues;
+  paramTgValues.add(getSharedPtr(tgSrcRef));
+  if (!generation->generateVarMove(
+    varAstType, tgVarRef, astNode, &paramAstNodes, &paramAstTypes, &paramTgValues, session
+  )) return false;
+
+  // The source no longer owns its content, so it shouldn't be destroyed.
+  node->hasDestructor = false;
+  node->tgMovableRef.reset();
+  moved = true;
+  return true;
+}
+
+
 Bool Generator::_generateMemberVarInitialization(
   TiObject *self, TiObject *astMemberNode, Session *session
 ) {
@@ -826,19 +1000,16 @@ void Generator::_registerDestructor(
 ) {
   PREPARE_SELF(generator, Generator);
 
-  // Skip if the type has no custom destructors.
+  // Vars without custom destructors are still added to the list so that their lifetimes end with their scopes.
   auto astUserType = ti_cast<Ast::UserType>(astType);
-  if (
-    astUserType == 0 || astUserType->getDestructionMethod(generator->getAstHelper(), ec) == Ast::TypeInitMethod::NONE
-  ) {
-    return;
-  }
 
   // Add the var node to the list.
   auto node = newSrdObj<DestructionNode>();
   node->astNode = varAstNode;
   node->astType = astType;
   node->tgVar = tgVar;
+  node->hasDestructor =
+    astUserType != 0 && astUserType->getDestructionMethod(generator->getAstHelper(), ec) != Ast::TypeInitMethod::NONE;
   destructionStack->pushItem(node);
 }
 
@@ -851,18 +1022,108 @@ Bool Generator::_generateVarGroupDestruction(
   for (; index < session->getDestructionStack()->getItemCount(); ++index) {
     auto node = session->getDestructionStack()->getItem(index);
 
-    TioSharedPtr tgVarRef;
-    if (!session->getTg()->generateVarReference(session->getTgContext(), node->astType, node->tgVar.get(), tgVarRef)) {
-      return false;
+    if (node->hasDestructor) {
+      TioSharedPtr tgVarRef;
+      if (!session->getTg()->generateVarReference(
+        session->getTgContext(), node->astType, node->tgVar.get(), tgVarRef
+      )) {
+        return false;
+      }
+
+      if (!generation->generateVarDestruction(node->astType, tgVarRef.get(), node->astNode, session)) return false;
     }
 
-    if (!generation->generateVarDestruction(node->astType, tgVarRef.get(), node->astNode, session)) return false;
+    if (!session->getTg()->generateVarLifetimeEnd(session->getTgContext(), node->tgVar.get())) return false;
   }
 
   return true;
 }
 
 
+Bool Generator::_generateFunctionReturn(
+  TiObject *self, Session *session, Ast::Type *astRetType, TiObject *tgRetVal
+) {
+  PREPARE_SELF(generation, Generation);
+
+  auto tg = session->getTg();
+  auto destructionStack = session->getDestructionStack();
+  auto tgRetType = session->getEda()->getCodeGenData<TiObject>(astRetType);
+
+  std::vector<DestructionNode*> nodes;
+  for (Int i = 0; i < destructionStack->getItemCount(); ++i) {
+    auto node = destructionStack->getItem(i);
+    if (node->hasDestructor) nodes.push_back(node);
+  }
+  if (nodes.empty()) {
+    if (!generation->generateVarGroupDestruction(session, 0)) return false;
+    return tg->generateReturn(session->getTgContext(), tgRetType, tgRetVal);
+  }
+
+  // Instead of repeating the destruction code at every return statement, each var gets a single cleanup block that
+  // is shared by all return statements. A return statement jumps to the cleanup block of the first var using its
+  // own selector, and each cleanup block continues to the next var of that return statement, or to the return
+  // block after the last var. Lifetime markers are not needed since the function is exiting anyway.
+  std::vector<DestructionNode*> newNodes;
+  for (auto node : nodes) {
+    if (node->tgCleanupContext != 0) continue;
+    if (!tg->prepareCleanupBlock(session->getTgContext(), node->tgCleanupContext)) return false;
+    DestructionStack cleanupDestructionStack;
+    Session cleanupSession(
+      session, node->tgCleanupContext.get(), session->getTgAllocContext(), &cleanupDestructionStack
+    );
+    TioSharedPtr tgVarRef;
+    if (!tg->generateVarReference(node->tgCleanupContext.get(), node->astType, node->tgVar.get(), tgVarRef)) {
+      return false;
+    }
+    if (!generation->generateVarDestruction(node->astType, tgVarRef.get(), node->astNode, &cleanupSession)) {
+      return false;
+    }
+    if (!generation->generateVarGroupDestruction(&cleanupSession, 0)) return false;
+    newNodes.push_back(node);
+  }
+  if (destructionStack->getTgReturnContext() == 0) {
+    TioSharedPtr tgReturnContext;
+    if (!tg->prepareCleanupBlock(session->getTgContext(), tgReturnContext)) return false;
+    TioSharedPtr tgRetValVar;
+    TioSharedPtr tgLoadedRetVal;
+    if (tgRetVal != 0) {
+      if (!tg->generateLocalVariable(session->getTgContext(), tgRetType, S("#retVal"), 0, tgRetValVar)) return false;
+      TioSharedPtr tgRetValRef;
+      if (!tg->generateVarReference(tgReturnContext.get(), tgRetType, tgRetValVar.get(), tgRetValRef)) return false;
+      if (!tg->generateDereference(tgReturnContext.get(), tgRetType, tgRetValRef.get(), tgLoadedRetVal)) {
+        return false;
+      }
+    }
+    if (!tg->generateReturn(tgReturnContext.get(), tgRetType, tgLoadedRetVal.get())) return false;
+    destructionStack->setTgReturnContext(tgReturnContext, tgRetValVar);
+  }
+  for (auto node : newNodes) {
+    if (!tg->finishCleanupBlock(node->tgCleanupContext.get(), destructionStack->getTgReturnContext())) return false;
+  }
+
+  // Store the returned value then jump into the cleanup chain.
+  if (tgRetVal != 0) {
+    TioSharedPtr tgRetValRef;
+    TioSharedPtr tgAssignResult;
+    if (!tg->generateVarReference(
+      session->getTgContext(), tgRetType, destructionStack->getTgRetValVar(), tgRetValRef
+    )) {
+      return false;
+    }
+    if (!tg->generateAssign(session->getTgContext(), tgRetType, tgRetVal, tgRetValRef.get(), tgAssignResult)) {
+      return false;
+    }
+  }
+  auto selector = destructionStack->addReturn();
+  for (Word i = 0; i + 1 < nodes.size(); ++i) {
+    if (!tg->addCleanupBlockExit(nodes[i]->tgCleanupContext.get(), selector, nodes[i + 1]->tgCleanupContext.get())) {
+      return false;
+    }
+  }
+  return tg->generateCleanupJump(session->getTgContext(), nodes[0]->tgCleanupContext.get(), selector);
+}
+
+
 Bool Generator::_generateStatementBlock(
   TiObject *self, TiObject *astBlock, Session *session, TerminalStatement &terminal
 ) {
@@ -910,6 +1171,15 @@ Bool Generator::_generateStatement(
   terminal = TerminalStatement::NO;
   Bool retVal = true;
 
+  // Attribute the code of this statement to its source location.
+  if (session->getTgContext() != 0) {
+    if (!session->getTg()->setDebugLocation(
+      session->getTgContext(), Core::Data::Ast::findSourceLocation(astNode).get()
+    )) {
+      return false;
+    }
+  }
+
   if (astNode->isDerivedFrom<Core::Data::Ast::Definition>()) {
     auto def = static_cast<Core::Data::Ast::Definition*>(astNode);
     auto target = def->getTarget().get();
@@ -956,6 +1226,9 @@ Bool Generator::_generateStatement(
     terminal = TerminalStatement::YES;
     auto breakStatement = static_cast<Spp::Ast::BreakStatement*>(astNode);
     retVal = generator->commandGenerator->generateBreakStatement(breakStatement, generation, session);
+  } else if (astNode->isDerivedFrom<Spp::Ast::FenceStatement>()) {
+    auto fenceStatement = static_cast<Spp::Ast::FenceStatement*>(astNode);
+    retVal = generator->commandGenerator->generateFenceStatement(fenceStatement, generation, session);
   } else if (astNode->isDerivedFrom<Spp::Ast::ReturnStatement>()) {
     terminal = TerminalStatement::YES;
     auto returnStatement = static_cast<Spp::Ast::ReturnStatement*>(astNode);
@@ -1086,4 +1359,92 @@ Str Generator::getTempVarName()
   return Str("#temp") + (LongInt)(this->tempVarIndex++);
 }
 
+
+Ast::Function* Generator::lookupMoveOp(
+  Spp::Ast::Type *varAstType, Core::Data::Node *astNode, PlainList<TiObject> *paramAstTypes, Session *session
+) {
+  static Core::Data::Ast::Identifier ref({{ S("value"), TiStr(S("~move")) }});
+  Ast::CalleeLookupRequest lookupRequest;
+  lookupRequest.astNode = astNode;
+  lookupRequest.target = varAstType;
+  lookupRequest.thisType = this->astHelper->getReferenceTypeFor(varAstType, Ast::ReferenceMode::IMPLICIT);
+  lookupRequest.mode = Ast::CalleeLookupMode::OBJECT_MEMBER;
+  lookupRequest.skipInjections = true;
+  lookupRequest.ref = &ref;
+  lookupRequest.argTypes = paramAstTypes;
+  lookupRequest.op = S("~move");
+  lookupRequest.ec = session->getExecutionContext();
+  Ast::CalleeLookupResult lookupResult;
+  this->calleeTracer->lookupCallee(lookupRequest, lookupResult);
+  if (lookupResult.isSuccessful() && lookupResult.stack.getLength() == 1) {
+    return static_cast<Ast::Function*>(lookupResult.stack(lookupResult.stack.getLength() - 1).obj);
+  } else {
+    return 0;
+  }
+}
+
+
+TiObject* Generator::findReturnedLocalVar(Ast::Block *astBlock)
+{
+  if (astBlock == 0) return 0;
+  TiObject *astVar = 0;
+  for (Int i = 0; i < astBlock->getCount(); ++i) {
+    if (!this->findReturnedVar(astBlock->getElement(i), astBlock, i, astVar)) return 0;
+  }
+  return astVar;
+}
+
+
+Bool Generator::findReturnedVar(TiObject *astNode, Ast::Block *astBlock, Int index, TiObject *&astVar)
+{
+  if (astNode == 0) return true;
+  // Nested functions and types have their own return statements.
+  if (
+    astNode->isDerivedFrom<Ast::Function>() || astNode->isDerivedFrom<Ast::UserType>() ||
+    astNode->isDerivedFrom<Ast::Module>() || astNode->isDerivedFrom<Ast::Macro>() ||
+    astNode->isDerivedFrom<Ast::Template>()
+  ) {
+    return true;
+  }
+  // Statements that are transformed at generation time could introduce other return statements.
+  if (astNode->isDerivedFrom<Ast::PreGenTransformStatement>() || astNode->isDerivedFrom<Ast::PreprocessStatement>()) {
+    return false;
+  }
+
+  if (astNode->isDerivedFrom<Ast::ReturnStatement>()) {
+    auto returnStatement = static_cast<Ast::ReturnStatement*>(astNode);
+    auto operand = returnStatement->getOperand().get();
+    if (operand == 0 || !operand->isDerivedFrom<Core::Data::Ast::Identifier>()) return false;
+    TiObject *target;
+    if (!this->astHelper->getSeeker()->tryGet(operand, returnStatement->getOwner(), target)) return false;
+    if (astVar == 0) {
+      // The var must be defined at the top level of the function body before any return statement.
+      for (Int i = 0; i < index; ++i) {
+        auto def = ti_cast<Core::Data::Ast::Definition>(astBlock->getElement(i));
+        if (def != 0 && def->getTarget().get() == target) {
+          if (
+            !this->astHelper->isInMemVariable(target) ||
+            this->astHelper->getVariableDomain(def) != Ast::DefinitionDomain::FUNCTION
+          ) {
+            return false;
+          }
+          astVar = target;
+          return true;
+        }
+      }
+      return false;
+    } else {
+      return target == astVar;
+    }
+  }
+
+  auto containing = ti_cast<Containing<TiObject>>(astNode);
+  if (containing != 0) {
+    for (Int i = 0; i < containing->getElementCount(); ++i) {
+      if (!this->findReturnedVar(containing->getElement(i), astBlock, index, astVar)) return false;
+    }
+  }
+  return true;
+}
+
 } // namespace
@@ -186,6 +186,18 @@ class Generator : public TiObject, public DynamicBinding, public DynamicInterfac
     Session *session
   );
 
+  private: static Bool _generateVarMove(
+    TiObject *self, Spp::Ast::Type *varAstType, TiObject *tgVarRef, Core::Data::Node *astNode,
+    PlainList<TiObject>* paramAstNodes, PlainList<TiObject> *paramAstTypes, SharedList<TiObject> *paramTgValues,
+    Session *session
+  );
+
+  private: static Bool _moveExpiringValue(
+    TiObject *self, Spp::Ast::Type *varAstType, TiObject *tgVarRef, Core::Data::Node *astNode,
+    Core::Data::Node *srcAstNode, Spp::Ast::Type *srcAstType, TiObject *tgSrcRef, Bool assign, Session *session,
+    Bool &moved
+  );
+
   private: static Bool _generateMemberVarInitialization(
     TiObject *self, TiObject *astMemberNode, Session *session
   );
@@ -207,6 +219,10 @@ class Generator : public TiObject, public DynamicBinding, public DynamicInterfac
     TiObject *self, Session *session, Int index
   );
 
+  private: static Bool _generateFunctionReturn(
+    TiObject *self, Session *session, Ast::Type *astRetType, TiObject *tgRetVal
+  );
+
   private: static Bool _generateStatementBlock(
     TiObject *self, TiObject *astBlock, Session *session,
     TerminalStatement &terminal
@@ -251,6 +267,14 @@ class Generator : public TiObject, public DynamicBinding, public DynamicInterfac
 
   private: Str getTempVarName();
 
+  private: TiObject* findReturnedLocalVar(Ast::Block *astBlock);
+
+  private: Bool findReturnedVar(TiObject *astNode, Ast::Block *astBlock, Int index, TiObject *&astVar);
+
+  private: Ast::Function* lookupMoveOp(
+    Spp::Ast::Type *varAstType, Core::Data::Node *astNode, PlainList<TiObject> *paramAstTypes, Session *session
+  );
+
   /// @}
 
 }; // class
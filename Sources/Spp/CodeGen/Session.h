@@ -39,6 +39,10 @@ class Session : public TiObject
   private: Bool offlineExecution;
   private: TioSharedPtr tgSelf;
   private: Ast::Type *astSelfType;
+  private: TiObject *astReturnedVar;
+  private: TiObject *astResultSlotValue;
+  private: Ast::Type *astResultSlotType;
+  private: TioSharedPtr tgResultSlot;
 
 
   //============================================================================
@@ -60,6 +64,9 @@ class Session : public TiObject
     , offlineExecution(offlineExec)
     , tgSelf(0)
     , astSelfType(0)
+    , astReturnedVar(0)
+    , astResultSlotValue(0)
+    , astResultSlotType(0)
   {}
 
   public: Session(Session *session, TiObject *tgc, TiObject *tgac)
@@ -75,6 +82,10 @@ class Session : public TiObject
     , offlineExecution(session->isOfflineExecution())
     , tgSelf(session->getTgSelf())
     , astSelfType(session->getAstSelfType())
+    , astReturnedVar(session->getAstReturnedVar())
+    , astResultSlotValue(session->getAstResultSlotValue())
+    , astResultSlotType(session->getAstResultSlotType())
+    , tgResultSlot(session->getTgResultSlot())
   {}
 
   public: Session(Session *session, TiObject *tgc, TiObject *tgac, DestructionStack *ds)
@@ -90,6 +101,10 @@ class Session : public TiObject
     , offlineExecution(session->isOfflineExecution())
     , tgSelf(session->getTgSelf())
     , astSelfType(session->getAstSelfType())
+    , astReturnedVar(session->getAstReturnedVar())
+    , astResultSlotValue(session->getAstResultSlotValue())
+    , astResultSlotType(session->getAstResultSlotType())
+    , tgResultSlot(session->getTgResultSlot())
   {}
 
   public: Session(
@@ -106,6 +121,10 @@ class Session : public TiObject
     , offlineExecution(session->isOfflineExecution())
     , tgSelf(tgs)
     , astSelfType(astst)
+    , astReturnedVar(session->getAstReturnedVar())
+    , astResultSlotValue(session->getAstResultSlotValue())
+    , astResultSlotType(session->getAstResultSlotType())
+    , tgResultSlot(session->getTgResultSlot())
   {}
 
 
@@ -178,6 +197,34 @@ class Session : public TiObject
     return this->astSelfType;
   }
 
+  /// The local var that is constructed directly in the function's return slot, if any.
+  public: void setAstReturnedVar(TiObject *var) {
+    this->astReturnedVar = var;
+  }
+
+  public: TiObject* getAstReturnedVar() {
+    return this->astReturnedVar;
+  }
+
+  /// Sets the storage in which the value of the given expression can be generated directly instead of a temp var.
+  public: void setResultSlot(TiObject *astValue, Ast::Type *astType, TioSharedPtr const &tgRef) {
+    this->astResultSlotValue = astValue;
+    this->astResultSlotType = astType;
+    this->tgResultSlot = tgRef;
+  }
+
+  public: TiObject* getAstResultSlotValue() {
+    return this->astResultSlotValue;
+  }
+
+  public: Ast::Type* getAstResultSlotType() {
+    return this->astResultSlotType;
+  }
+
+  public: TioSharedPtr const& getTgResultSlot() {
+    return this->tgResultSlot;
+  }
+
 }; // class
 
 } // namespace
@@ -41,24 +41,39 @@ class TargetGeneration : public ObjTiInterface
       &this->generateFloatType,
       &this->generatePointerType,
       &this->generateArrayType,
+      &this->generateVectorType,
       &this->generateStructTypeDecl,
       &this->generateStructTypeBody,
       &this->getTypeAllocationSize,
       &this->generateFunctionType,
+      &this->generateFunctionArgAttributes,
       &this->generateFunctionDecl,
+      &this->generateIntrinsicFunctionDecl,
+      &this->generateFunctionAttributes,
       &this->prepareFunctionBody,
       &this->finishFunctionBody,
       &this->deleteFunction,
+      &this->exportFunction,
       &this->generateGlobalVariable,
       &this->generateLocalVariable,
+      &this->generateVarLifetimeStart,
+      &this->generateVarLifetimeEnd,
+      &this->prepareFunctionDebugInfo,
+      &this->setDebugLocation,
+      &this->generateVarDebugInfo,
       &this->prepareIfStatement,
       &this->finishIfStatement,
       &this->prepareWhileStatement,
       &this->finishWhileStatement,
       &this->prepareForStatement,
       &this->finishForStatement,
+      &this->generateLoopHints,
       &this->generateContinue,
       &this->generateBreak,
+      &this->prepareCleanupBlock,
+      &this->finishCleanupBlock,
+      &this->addCleanupBlockExit,
+      &this->generateCleanupJump,
       &this->generateCastIntToInt,
       &this->generateCastIntToFloat,
       &this->generateCastFloatToInt,
@@ -106,12 +121,21 @@ class TargetGeneration : public ObjTiInterface
       &this->generateGreaterThanOrEqual,
       &this->generateLessThan,
       &this->generateLessThanOrEqual,
+      &this->generateVectorSplat,
+      &this->generateVectorShuffle,
+      &this->generateVectorReduction,
+      &this->generateAtomicLoad,
+      &this->generateAtomicStore,
+      &this->generateAtomicRmw,
+      &this->generateAtomicCmpXchg,
+      &this->generateFence,
       &this->generateIntLiteral,
       &this->generateFloatLiteral,
       &this->generateStringLiteral,
       &this->generateNullPtrLiteral,
       &this->generateStructLiteral,
       &this->generateArrayLiteral,
+      &this->generateVectorLiteral,
       &this->generatePointerLiteral
     });
   }
@@ -158,6 +182,10 @@ class TargetGeneration : public ObjTiInterface
     Bool, (TiObject* /* contentType */, Word /* size */, TioSharedPtr& /* type */)
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorType,
+    Bool, (TiObject* /* elementType */, Word /* size */, TioSharedPtr& /* type */)
+  );
+
   public: METHOD_BINDING_CACHE(generateStructTypeDecl,
     Bool, (
       Char const* /* name */, TioSharedPtr& /* type */
@@ -185,12 +213,24 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateFunctionArgAttributes,
+    Bool, (TiObject* /* functionType */, Word /* argIndex */, Word /* attributes */)
+  );
+
   public: METHOD_BINDING_CACHE(generateFunctionDecl,
     Bool, (
       Char const* /* name */, TiObject* /* functionType */, TioSharedPtr& /* function */
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateIntrinsicFunctionDecl,
+    Bool, (
+      Char const* /* name */, TiObject* /* functionType */, TioSharedPtr& /* function */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateFunctionAttributes, Bool, (TiObject* /* function */, Word /* attributes */));
+
   public: METHOD_BINDING_CACHE(prepareFunctionBody,
     Bool, (
       TiObject* /* function */, TiObject* /* functionType */,
@@ -207,6 +247,8 @@ class TargetGeneration : public ObjTiInterface
 
   public: METHOD_BINDING_CACHE(deleteFunction, Bool, (TiObject* /* function */));
 
+  public: METHOD_BINDING_CACHE(exportFunction, Bool, (TiObject* /* function */));
+
   /// @}
 
   /// @name Variable Definition Generation Functions
@@ -225,6 +267,33 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateVarLifetimeStart, Bool, (TiObject* /* context */, TiObject* /* varDefinition */));
+
+  public: METHOD_BINDING_CACHE(generateVarLifetimeEnd, Bool, (TiObject* /* context */, TiObject* /* varDefinition */));
+
+  /// @}
+
+  /// @name Debug Info Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(prepareFunctionDebugInfo,
+    Bool, (
+      TiObject* /* function */, TiObject* /* functionType */, TiObject* /* context */,
+      Core::Data::SourceLocation* /* sourceLocation */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(setDebugLocation,
+    Bool, (TiObject* /* context */, Core::Data::SourceLocation* /* sourceLocation */)
+  );
+
+  public: METHOD_BINDING_CACHE(generateVarDebugInfo,
+    Bool, (
+      TiObject* /* context */, TiObject* /* varDefinition */, TiObject* /* type */, Char const* /* name */,
+      Word /* argNumber */, Core::Data::SourceLocation* /* sourceLocation */
+    )
+  );
+
   /// @}
 
   /// @name Statements Generation Functions
@@ -251,6 +320,10 @@ class TargetGeneration : public ObjTiInterface
     Bool, (TiObject* /* context */, LoopTgContext* /* loopTgContext */, TiObject* /* conditionVal */)
   );
 
+  public: METHOD_BINDING_CACHE(generateLoopHints,
+    Bool, (LoopTgContext* /* loopTgContext */, Word /* hints */, Word /* unrollCount */, Word /* vectorizeWidth */)
+  );
+
   public: METHOD_BINDING_CACHE(generateContinue,
     Bool, (TiObject* /* context */, LoopTgContext* /* loopTgContext */)
   );
@@ -258,6 +331,22 @@ class TargetGeneration : public ObjTiInterface
     Bool, (TiObject* /* context */, LoopTgContext* /* loopTgContext */)
   );
 
+  /// Creates an unreachable block in the same function as the given context. Cleanup blocks are entered with a
+  /// selector value that picks the block to continue to after the cleanup code.
+  public: METHOD_BINDING_CACHE(prepareCleanupBlock,
+    Bool, (TiObject* /* context */, TioSharedPtr& /* cleanupContext */)
+  );
+  /// Terminates the cleanup block. Selectors without an explicit exit continue to the given exit context.
+  public: METHOD_BINDING_CACHE(finishCleanupBlock,
+    Bool, (TiObject* /* cleanupContext */, TiObject* /* exitContext */)
+  );
+  public: METHOD_BINDING_CACHE(addCleanupBlockExit,
+    Bool, (TiObject* /* cleanupContext */, Word /* selector */, TiObject* /* targetContext */)
+  );
+  public: METHOD_BINDING_CACHE(generateCleanupJump,
+    Bool, (TiObject* /* context */, TiObject* /* cleanupContext */, Word /* selector */)
+  );
+
   /// @}
 
   /// @name Casting Generation Functions
@@ -608,6 +697,71 @@ class TargetGeneration : public ObjTiInterface
 
   /// @}
 
+  /// @name Vector Operation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateVectorSplat,
+    Bool, (
+      TiObject* /* context */, TiObject* /* vectorType */, TiObject* /* srcVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  /// Indices select from the concatenation of the two vectors. srcVal2 can be null to shuffle a single vector.
+  public: METHOD_BINDING_CACHE(generateVectorShuffle,
+    Bool, (
+      TiObject* /* context */, TiObject* /* srcVal1 */, TiObject* /* srcVal2 */,
+      Containing<TiObject>* /* indices */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateVectorReduction,
+    Bool, (
+      TiObject* /* context */, TiObject* /* vectorType */, VectorReduction /* op */,
+      TiObject* /* srcVal */, TioSharedPtr& /* result */
+    )
+  );
+
+  /// @}
+
+  /// @name Atomic Operation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateAtomicLoad,
+    Bool, (
+      TiObject* /* context */, TiObject* /* contentType */, TiObject* /* srcRef */, AtomicOrdering /* ordering */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicStore,
+    Bool, (
+      TiObject* /* context */, TiObject* /* contentType */, TiObject* /* srcVal */, TiObject* /* destRef */,
+      AtomicOrdering /* ordering */
+    )
+  );
+
+  /// The result is the value held by destRef before the operation.
+  public: METHOD_BINDING_CACHE(generateAtomicRmw,
+    Bool, (
+      TiObject* /* context */, TiObject* /* contentType */, AtomicOperation /* op */, TiObject* /* srcVal */,
+      TiObject* /* destRef */, AtomicOrdering /* ordering */, TioSharedPtr& /* result */
+    )
+  );
+
+  /// The result is the value held by destRef before the operation, which equals cmpVal if the exchange happened.
+  public: METHOD_BINDING_CACHE(generateAtomicCmpXchg,
+    Bool, (
+      TiObject* /* context */, TiObject* /* contentType */, TiObject* /* cmpVal */, TiObject* /* newVal */,
+      TiObject* /* destRef */, AtomicOrdering /* ordering */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateFence,
+    Bool, (TiObject* /* context */, AtomicOrdering /* ordering */)
+  );
+
+  /// @}
+
   /// @name Literal Generation Functions
   /// @{
 
@@ -650,6 +804,13 @@ class TargetGeneration : public ObjTiInterface
     )
   );
 
+  public: METHOD_BINDING_CACHE(generateVectorLiteral,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, Containing<TiObject>* /* elementVals */,
+      TioSharedPtr& /* destVal */
+    )
+  );
+
   public: METHOD_BINDING_CACHE(generatePointerLiteral,
     Bool, (TiObject* /* context */, TiObject* /* type */, void* /* value */, TioSharedPtr& /* destVal */)
   );
@@ -29,6 +29,7 @@ void TypeGenerator::initBindingCaches()
     &this->generatePointerType,
     &this->generateReferenceType,
     &this->generateArrayType,
+    &this->generateVectorType,
     &this->generateUserType,
     &this->generateUserTypeMemberVars,
     &this->generateUserTypeAutoConstructor,
@@ -37,6 +38,7 @@ void TypeGenerator::initBindingCaches()
     &this->generateCast,
     &this->generateDefaultValue,
     &this->generateDefaultArrayValue,
+    &this->generateDefaultVectorValue,
     &this->generateDefaultUserTypeValue,
     &this->getTypeAllocationSize
   });
@@ -52,6 +54,7 @@ void TypeGenerator::initBindings()
   this->generatePointerType = &TypeGenerator::_generatePointerType;
   this->generateReferenceType = &TypeGenerator::_generateReferenceType;
   this->generateArrayType = &TypeGenerator::_generateArrayType;
+  this->generateVectorType = &TypeGenerator::_generateVectorType;
   this->generateUserType = &TypeGenerator::_generateUserType;
   this->generateUserTypeMemberVars = &TypeGenerator::_generateUserTypeMemberVars;
   this->generateUserTypeAutoConstructor = &TypeGenerator::_generateUserTypeAutoConstructor;
@@ -60,6 +63,7 @@ void TypeGenerator::initBindings()
   this->generateCast = &TypeGenerator::_generateCast;
   this->generateDefaultValue = &TypeGenerator::_generateDefaultValue;
   this->generateDefaultArrayValue = &TypeGenerator::_generateDefaultArrayValue;
+  this->generateDefaultVectorValue = &TypeGenerator::_generateDefaultVectorValue;
   this->generateDefaultUserTypeValue = &TypeGenerator::_generateDefaultUserTypeValue;
   this->getTypeAllocationSize = &TypeGenerator::_getTypeAllocationSize;
 }
@@ -173,6 +177,8 @@ Bool TypeGenerator::_generateType(TiObject *self, Spp::Ast::Type *astType, Gener
     return typeGenerator->generateReferenceType(static_cast<Spp::Ast::ReferenceType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     return typeGenerator->generateArrayType(static_cast<Spp::Ast::ArrayType*>(astType), g, session);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    return typeGenerator->generateVectorType(static_cast<Spp::Ast::VectorType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     return typeGenerator->generateUserType(static_cast<Spp::Ast::UserType*>(astType), g, session);
   } else if (astType->isDerivedFrom<Spp::Ast::FunctionType>()) {
@@ -273,6 +279,30 @@ Bool TypeGenerator::_generateArrayType(TiObject *self, Spp::Ast::ArrayType *astT
 }
 
 
+Bool TypeGenerator::_generateVectorType(
+  TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session
+) {
+  PREPARE_SELF(typeGenerator, TypeGenerator);
+  auto elementAstType = astType->getContentType(typeGenerator->astHelper);
+  if (
+    elementAstType == 0 ||
+    (!elementAstType->isDerivedFrom<Spp::Ast::IntegerType>() && !elementAstType->isDerivedFrom<Spp::Ast::FloatType>())
+  ) {
+    typeGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidVectorElementTypeNotice>(astType->findSourceLocation())
+    );
+    return false;
+  }
+  if (!typeGenerator->generateType(elementAstType, g, session)) return false;
+  TiObject *elementTgType = session->getEda()->getCodeGenData<TiObject>(elementAstType);
+  auto size = astType->getSize(typeGenerator->astHelper);
+  TioSharedPtr tgType;
+  if (!session->getTg()->generateVectorType(elementTgType, size, tgType)) return false;
+  session->getEda()->setCodeGenData(astType, tgType);
+  return true;
+}
+
+
 Bool TypeGenerator::_generateUserType(TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session)
 {
   PREPARE_SELF(typeGenerator, TypeGenerator);
@@ -568,6 +598,7 @@ Bool TypeGenerator::_generateFunctionType(
   auto astArgs = astType->getArgTypes().get();
   auto argCount = astArgs == 0 ? 0 : astArgs->getCount();
   PlainMap<TiObject> tgArgs;
+  std::vector<Word> tgArgAttributes;
   for (Int i = 0; i < argCount; ++i) {
     auto argType = astArgs->getElement(i);
     if (argType->isDerivedFrom<Ast::ArgPack>()) break;
@@ -584,6 +615,13 @@ Bool TypeGenerator::_generateFunctionType(
       if (!typeGenerator->getGeneratedType(astPtrType, g, session, tgType, 0)) {
         return false;
       }
+      // The caller always passes an existing object, but that object can also be reachable through other args.
+      tgArgAttributes.push_back(FunctionArgAttribute::NON_NULL | FunctionArgAttribute::DEREFERENCEABLE);
+    } else if (astType->isDerivedFrom<Ast::ReferenceType>()) {
+      // References can be null (nullRef), so they can only be dereferenceable if not null.
+      tgArgAttributes.push_back(FunctionArgAttribute::DEREFERENCEABLE_OR_NULL);
+    } else {
+      tgArgAttributes.push_back(0);
     }
     tgArgs.add(astArgs->getKey(i), tgType);
     Ast::setAstType(argType, astType);
@@ -606,6 +644,11 @@ Bool TypeGenerator::_generateFunctionType(
         return false;
       }
       tgArgs.insert(0, S("#ret"), tgRetType);
+      // The caller always passes a fresh temp var to receive the return value.
+      tgArgAttributes.insert(
+        tgArgAttributes.begin(),
+        FunctionArgAttribute::NO_ALIAS | FunctionArgAttribute::NON_NULL | FunctionArgAttribute::DEREFERENCEABLE
+      );
       if (!typeGenerator->getGeneratedVoidType(g, session, tgRetType, 0)) return false;
     }
   } else {
@@ -615,6 +658,10 @@ Bool TypeGenerator::_generateFunctionType(
   // Generate the type.
   TioSharedPtr tgFuncType;
   if (!session->getTg()->generateFunctionType(&tgArgs, tgRetType, astType->isVariadic(), tgFuncType)) return false;
+  for (Int i = 0; i < tgArgAttributes.size(); ++i) {
+    if (tgArgAttributes[i] == 0) continue;
+    if (!session->getTg()->generateFunctionArgAttributes(tgFuncType.get(), i, tgArgAttributes[i])) return false;
+  }
   session->getEda()->setCodeGenData(astType, tgFuncType);
   return true;
 }
@@ -862,6 +909,9 @@ Bool TypeGenerator::_generateDefaultValue(
   } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
     // Generate zeroed out array.
     return typeGenerator->generateDefaultArrayValue(static_cast<Ast::ArrayType*>(astType), g, session, result);
+  } else if (astType->isDerivedFrom<Spp::Ast::VectorType>()) {
+    // Generate zeroed out vector.
+    return typeGenerator->generateDefaultVectorValue(static_cast<Ast::VectorType*>(astType), g, session, result);
   } else if (astType->isDerivedFrom<Spp::Ast::UserType>()) {
     // Generate zeroed out structure.
     return typeGenerator->generateDefaultUserTypeValue(static_cast<Ast::UserType*>(astType), g, session, result);
@@ -902,6 +952,31 @@ Bool TypeGenerator::_generateDefaultArrayValue(
 }
 
 
+Bool TypeGenerator::_generateDefaultVectorValue(
+  TiObject *self, Spp::Ast::VectorType *astType, Generation *g, Session *session, TioSharedPtr &result
+) {
+  PREPARE_SELF(typeGenerator, TypeGenerator);
+
+  auto tgType = session->getEda()->tryGetCodeGenData<TiObject>(astType);
+  if (tgType == 0) {
+    if (!typeGenerator->generateType(astType, g, session)) return false;
+    tgType = session->getEda()->getCodeGenData<TiObject>(astType);
+  }
+
+  auto elementAstType = astType->getContentType(typeGenerator->astHelper);
+  TioSharedPtr elementVal;
+  if (!typeGenerator->generateDefaultValue(elementAstType, g, session, elementVal)) return false;
+
+  auto size = astType->getSize(typeGenerator->astHelper);
+  SharedList<TiObject> elementVals;
+  for (Word i = 0; i < size; ++i) {
+    elementVals.add(elementVal);
+  }
+
+  return session->getTg()->generateVectorLiteral(session->getTgContext(), tgType, &elementVals, result);
+}
+
+
 Bool TypeGenerator::_generateDefaultUserTypeValue(
   TiObject *self, Spp::Ast::UserType *astType, Generation *g, Session *session, TioSharedPtr &result
 ) {
@@ -36,6 +36,45 @@ struct GenResult
 
 s_enum(TerminalStatement, UNKNOWN, NO, YES);
 
+/// Flags for attributes of generated functions.
+s_enum(FunctionAttribute,
+  ALWAYS_INLINE = 1,
+  NO_INLINE = 2,
+  HOT = 4,
+  COLD = 8,
+  READ_ONLY = 16,
+  NO_UNWIND = 32,
+  WILL_RETURN = 64
+);
+
+/// Flags for attributes of the pointer args of generated functions. Dereferenceability is computed by the target
+/// from the arg's content type.
+s_enum(FunctionArgAttribute,
+  NO_ALIAS = 1,
+  NON_NULL = 2,
+  DEREFERENCEABLE = 4,
+  DEREFERENCEABLE_OR_NULL = 8
+);
+
+/// Flags for optimization hints of generated loops. The unroll count and vectorize width are given separately and
+/// are only used with UNROLL and VECTORIZE respectively, with 0 leaving the choice to the target.
+s_enum(LoopHint,
+  UNROLL = 1,
+  NO_UNROLL = 2,
+  VECTORIZE = 4,
+  NO_VECTORIZE = 8,
+  PARALLEL_SAFE = 16
+);
+
+/// Operations for reducing the elements of a vector into a single value.
+ti_s_enum(VectorReduction, TiInt, "Spp.CodeGen", "Spp", "alusus.org", ADD, MUL, MIN, MAX, AND, OR, XOR);
+
+/// Read-modify-write operations of atomic memory accesses.
+ti_s_enum(AtomicOperation, TiInt, "Spp.CodeGen", "Spp", "alusus.org", XCHG, ADD, SUB, AND, OR, XOR, MIN, MAX);
+
+/// Memory orderings of atomic memory accesses and fences.
+ti_s_enum(AtomicOrdering, TiInt, "Spp.CodeGen", "Spp", "alusus.org", RELAXED, ACQUIRE, RELEASE, ACQ_REL, SEQ_CST);
+
 
 //==============================================================================
 // Global Functions
@@ -110,6 +149,23 @@ inline void removeExtra(OT *object, Char const *name)
   metadata->removeExtra(name);
 }
 
+// getAtomicOrdering
+
+/// Translates the name of a memory ordering given in the source code.
+inline Bool getAtomicOrdering(TiObject *astNode, AtomicOrdering &ordering)
+{
+  auto identifier = ti_cast<Core::Data::Ast::Identifier>(astNode);
+  if (identifier == 0) return false;
+  auto &name = identifier->getValue();
+  if (name == S("relaxed") || name == S("مرتخ")) ordering = AtomicOrdering::RELAXED;
+  else if (name == S("acquire") || name == S("اكتساب")) ordering = AtomicOrdering::ACQUIRE;
+  else if (name == S("release") || name == S("تحرير")) ordering = AtomicOrdering::RELEASE;
+  else if (name == S("acq_rel") || name == S("اكتساب_تحرير")) ordering = AtomicOrdering::ACQ_REL;
+  else if (name == S("seq_cst") || name == S("تتابعي")) ordering = AtomicOrdering::SEQ_CST;
+  else return false;
+  return true;
+}
+
 // Ast Related Accessors
 
 #define DEFINE_FLAG_ACCESSORS(name) \
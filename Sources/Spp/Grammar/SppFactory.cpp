@@ -36,6 +36,7 @@ void SppFactory::createGrammar()
     S("for"), S("لكل"),
     S("continue"), S("أكمل"),
     S("break"), S("اقطع"),
+    S("fence"), S("حاجز"),
     S("return"), S("أرجع"), S("ارجع"),
     S("module"), S("وحدة"),
     S("class"), S("type"), S("صنف"),
@@ -56,10 +57,14 @@ void SppFactory::createGrammar()
     S("value"), S("قيمة"),
     S("init"), S("هيئ"),
     S("terminate"), S("اتلف"), S("أتلف"),
+    S("move"), S("انقل"),
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
     S("next_arg"), S("المعطى_التالي"),
+    S("shuffle"), S("خلط"),
+    S("reduce"), S("اختزل"),
+    S("atomic"), S("ذري"),
     S("as_ptr"), S("كمؤشر"),
     S("set_ptr"), S("حدد_مؤشر"),
     S("no_injection"), S("بلا_حقن")
@@ -128,6 +133,13 @@ void SppFactory::createGrammar()
       }
     }
   }}, newSrdObj<Handlers::WhileParsingHandler>());
+  this->set(S("root.Main.While.modifierTranslations"), Map::create({}, {
+    {S("بسط"), TiStr::create(S("unroll"))},
+    {S("دون_بسط"), TiStr::create(S("no_unroll"))},
+    {S("توجيه"), TiStr::create(S("vectorize"))},
+    {S("دون_توجيه"), TiStr::create(S("no_vectorize"))},
+    {S("آمن_للتوازي"), TiStr::create(S("parallel_safe"))}
+  }));
 
   //// for = "for" + Exp + Statement
   this->createCommand(S("root.Main.For"), {{
@@ -147,6 +159,13 @@ void SppFactory::createGrammar()
       }
     }
   }}, newSrdObj<Handlers::ForParsingHandler>());
+  this->set(S("root.Main.For.modifierTranslations"), Map::create({}, {
+    {S("بسط"), TiStr::create(S("unroll"))},
+    {S("دون_بسط"), TiStr::create(S("no_unroll"))},
+    {S("توجيه"), TiStr::create(S("vectorize"))},
+    {S("دون_توجيه"), TiStr::create(S("no_vectorize"))},
+    {S("آمن_للتوازي"), TiStr::create(S("parallel_safe"))}
+  }));
 
   //// continue = "continue" + Subject.Literal
   this->createCommand(S("root.Main.Continue"), {{
@@ -206,6 +225,26 @@ void SppFactory::createGrammar()
     state->setData(breakStatement);
   }));
 
+  //// fence = "fence" + Subject.Parameter
+  this->createCommand(S("root.Main.Fence"), {{
+    Map::create({}, { { S("fence"), 0 }, { S("حاجز"), 0 } }),
+    {{
+      PARSE_REF(S("module.Subject.Parameter")),
+      TiInt::create(0),
+      TiInt::create(1),
+      TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+    }}
+  }}, newSrdObj<CustomParsingHandler>([](Parser *parser, ParserState *state) {
+    auto metadata = state->getData().ti_cast_get<Data::Ast::MetaHaving>();
+    auto currentList = state->getData().ti_cast_get<Containing<TiObject>>();
+    auto fenceStatement = Ast::FenceStatement::create({
+      { "prodId", metadata->getProdId() },
+      { "sourceLocation", metadata->findSourceLocation() }
+    });
+    if (currentList != 0) fenceStatement->setOrdering(getSharedPtr(currentList->getElement(1)));
+    state->setData(fenceStatement);
+  }));
+
   //// return = "return" + Expression
   this->createCommand(S("root.Main.Return"), {{
     Map::create({}, { { S("return"), 0 }, { S("أرجع"), 0 }, { S("ارجع"), 0 } }),
@@ -367,7 +406,13 @@ void SppFactory::createGrammar()
   this->set(S("root.Main.Function.modifierTranslations"), Map::create({}, {
     {S("تصدير"), TiStr::create(S("expname"))},
     {S("عضو"), TiStr::create(S("member"))},
-    {S("عملية"), TiStr::create(S("operation"))}
+    {S("عملية"), TiStr::create(S("operation"))},
+    {S("مضمن"), TiStr::create(S("inline"))},
+    {S("غير_مضمن"), TiStr::create(S("noinline"))},
+    {S("ساخن"), TiStr::create(S("hot"))},
+    {S("بارد"), TiStr::create(S("cold"))},
+    {S("نقي"), TiStr::create(S("pure"))},
+    {S("جوهري"), TiStr::create(S("intrinsic"))}
   }));
 
   // FuncSigExpression
@@ -776,6 +821,18 @@ void SppFactory::createGrammar()
       {S("fltr"), newSrdObj<TiInt>(1)}
     })}
   }).get());
+  // ~move
+  this->createCommand(S("root.Main.MoveTilde"), {{
+    Map::create({}, {{S("move"), 0}, {S("انقل"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.InitTildeSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::MoveOp>::create());
   // ~next_arg
   this->createCommand(S("root.Main.NextArgTilde"), {{
     Map::create({}, {{S("next_arg"), 0}, {S("المعطى_التالي"), 0}}),
@@ -788,6 +845,42 @@ void SppFactory::createGrammar()
       }
     }
   }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::NextArgOp>::create());
+  // ~shuffle
+  this->createCommand(S("root.Main.ShuffleTilde"), {{
+    Map::create({}, {{S("shuffle"), 0}, {S("خلط"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.CastSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::ShuffleOp>::create());
+  // ~reduce
+  this->createCommand(S("root.Main.ReduceTilde"), {{
+    Map::create({}, {{S("reduce"), 0}, {S("اختزل"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.CastSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::ReduceOp>::create());
+  // ~atomic
+  this->createCommand(S("root.Main.AtomicTilde"), {{
+    Map::create({}, {{S("atomic"), 0}, {S("ذري"), 0}}),
+    {
+      {
+        PARSE_REF(S("module.CastSubject")),
+        TiInt::create(1),
+        TiInt::create(1),
+        TiInt::create(ParsingFlags::PASS_ITEMS_UP)
+      }
+    }
+  }}, Spp::Handlers::TildeOpParsingHandler<Spp::Ast::AtomicOp>::create());
   // ~use_in = "~use_in" + Subject + UseInOptions + Set
   this->createCommand(S("root.Main.UseInTilde"), {{
     Map::create({}, {{S("use_in"), 0}, {S("استخدم_في"), 0}}),
@@ -842,6 +935,7 @@ void SppFactory::createGrammar()
     PARSE_REF(S("module.For")),
     PARSE_REF(S("module.Continue")),
     PARSE_REF(S("module.Break")),
+    PARSE_REF(S("module.Fence")),
     PARSE_REF(S("module.Return")),
     PARSE_REF(S("module.TypeOp"))
   });
@@ -857,7 +951,11 @@ void SppFactory::createGrammar()
     PARSE_REF(S("module.PointerTilde")),
     PARSE_REF(S("module.InitTilde")),
     PARSE_REF(S("module.TerminateTilde")),
+    PARSE_REF(S("module.MoveTilde")),
     PARSE_REF(S("module.NextArgTilde")),
+    PARSE_REF(S("module.ShuffleTilde")),
+    PARSE_REF(S("module.ReduceTilde")),
+    PARSE_REF(S("module.AtomicTilde")),
     PARSE_REF(S("module.UseInTilde"))
   });
 
@@ -889,6 +987,7 @@ void SppFactory::cleanGrammar()
     S("for"), S("لكل"),
     S("continue"), S("أكمل"),
     S("break"), S("اقطع"),
+    S("fence"), S("حاجز"),
     S("return"), S("أرجع"), S("ارجع"),
     S("module"), S("وحدة"),
     S("class"), S("type"), S("صنف"),
@@ -909,10 +1008,14 @@ void SppFactory::cleanGrammar()
     S("value"), S("قيمة"),
     S("init"), S("هيئ"),
     S("terminate"), S("اتلف"), S("أتلف"),
+    S("move"), S("انقل"),
     S("integer"), S("صحيح"),
     S("string"), S("محارف"),
     S("any"), S("أيما"),
     S("next_arg"), S("المعطى_التالي"),
+    S("shuffle"), S("خلط"),
+    S("reduce"), S("اختزل"),
+    S("atomic"), S("ذري"),
     S("as_ptr"), S("كمؤشر"),
     S("set_ptr"), S("حدد_مؤشر"),
     S("no_injection"), S("بلا_حقن")
@@ -936,7 +1039,11 @@ void SppFactory::cleanGrammar()
     S("module.PointerTilde"),
     S("module.InitTilde"),
     S("module.TerminateTilde"),
+    S("module.MoveTilde"),
     S("module.NextArgTilde"),
+    S("module.ShuffleTilde"),
+    S("module.ReduceTilde"),
+    S("module.AtomicTilde"),
     S("module.UseInTilde")
   });
 
@@ -947,6 +1054,7 @@ void SppFactory::cleanGrammar()
     S("module.For"),
     S("module.Continue"),
     S("module.Break"),
+    S("module.Fence"),
     S("module.Return"),
     S("module.TypeOp")
   });
@@ -977,7 +1085,11 @@ void SppFactory::cleanGrammar()
   this->tryRemove(S("root.Main.InitTildeSubject"));
   this->tryRemove(S("root.Main.TerminateTilde"));
   this->tryRemove(S("root.Main.TerminateTildeSubject"));
+  this->tryRemove(S("root.Main.MoveTilde"));
   this->tryRemove(S("root.Main.NextArgTilde"));
+  this->tryRemove(S("root.Main.ShuffleTilde"));
+  this->tryRemove(S("root.Main.ReduceTilde"));
+  this->tryRemove(S("root.Main.AtomicTilde"));
   this->tryRemove(S("root.Main.UseInTilde"));
   this->tryRemove(S("root.Main.UseInSubject"));
   this->tryRemove(S("root.Main.UseInOptions"));
@@ -988,6 +1100,7 @@ void SppFactory::cleanGrammar()
   this->tryRemove(S("root.Main.For"));
   this->tryRemove(S("root.Main.Continue"));
   this->tryRemove(S("root.Main.Break"));
+  this->tryRemove(S("root.Main.Fence"));
   this->tryRemove(S("root.Main.Return"));
   this->tryRemove(S("root.Main.TypeOp"));
   this->tryRemove(S("root.Main.TypeOpOptions"));
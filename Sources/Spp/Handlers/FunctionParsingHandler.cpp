@@ -211,6 +211,7 @@ Bool FunctionParsingHandler::onIncomingModifier(
 
   if (this->processExpnameModifier(state, modifierData)) return true;
   else if (this->processMemberModifier(state, modifierData)) return true;
+  else if (this->processOptimizationModifier(state, modifierData)) return true;
   else return this->processUnknownModifier(state, modifierData);
 }
 
@@ -218,16 +219,21 @@ Bool FunctionParsingHandler::onIncomingModifier(
 Bool FunctionParsingHandler::processExpnameModifier(
   Core::Processing::ParserState *state, TioSharedPtr const &modifierData
 ) {
-  // Look for expname modifier.
+  // Look for expname or intrinsic modifiers.
   auto paramPass = modifierData.ti_cast_get<Core::Data::Ast::ParamPass>();
   if (paramPass == 0) return false;
   if (paramPass->getType() != Core::Data::Ast::BracketType::SQUARE) return false;
   auto operand = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
   if (operand == 0) return false;
   auto symbolDef = state->refTopProdLevel().getProd();
-  if (symbolDef->getTranslatedModifierKeyword(operand->getValue().get()) != S("expname")) return false;
-  auto param = paramPass->getParam().ti_cast_get<Core::Data::Ast::Text>();
-  if (param == 0) return false;
+  auto keyword = symbolDef->getTranslatedModifierKeyword(operand->getValue().get());
+  if (keyword != S("expname") && keyword != S("intrinsic")) return false;
+  Str name;
+  if (!this->getModifierParamName(paramPass->getParam().get(), name)) return false;
+
+  // Intrinsic names can be given without the llvm prefix.
+  Bool intrinsic = keyword == S("intrinsic");
+  if (intrinsic && name.compare(S("llvm."), 5) != 0) name = Str(S("llvm.")) + name;
 
   Int levelOffset = -state->getTopProdTermLevelCount();
   TioSharedPtr data = state->getData(levelOffset);
@@ -247,14 +253,16 @@ Bool FunctionParsingHandler::processExpnameModifier(
     auto functionType = ti_cast<Spp::Ast::FunctionType>(data);
 
     // If it's not a function type then we can't accept this modifier. This could be because the object is a template
-    // which shouldn't accept expname modifiers.
+    // which shouldn't accept expname or intrinsic modifiers.
     if (functionType == 0) return false;
 
     auto newFunction = newSrdObj<Spp::Ast::Function>();
     newFunction->setType(functionType);
     newFunction->setSourceLocation(functionType->findSourceLocation());
     newFunction->setProdId(functionType->getProdId());
-    newFunction->setName(param->getValue());
+    newFunction->setName(name);
+    newFunction->setExported(!intrinsic);
+    newFunction->setIntrinsic(intrinsic);
     // If a definition exists, update its target with the new function, otherwise set the new function to the state.
     if (definition != 0) {
       definition->setTarget(newFunction);
@@ -262,9 +270,30 @@ Bool FunctionParsingHandler::processExpnameModifier(
       state->setData(newFunction, levelOffset);
     }
   } else {
-    function->setName(param->getValue());
+    function->setName(name);
+    function->setExported(!intrinsic);
+    function->setIntrinsic(intrinsic);
+  }
+
+  return true;
+}
+
+
+Bool FunctionParsingHandler::getModifierParamName(TiObject *param, Str &name)
+{
+  auto text = ti_cast<Core::Data::Ast::Text>(param);
+  if (text != 0) {
+    name = text->getValue().get();
+    return true;
   }
 
+  // Dotted names, like the full names of intrinsics, are parsed as link operators.
+  auto link = ti_cast<Core::Data::Ast::LinkOperator>(param);
+  if (link == 0 || link->getType() != S(".")) return false;
+  Str first, second;
+  if (!this->getModifierParamName(link->getFirst().get(), first)) return false;
+  if (!this->getModifierParamName(link->getSecond().get(), second)) return false;
+  name = first + S(".") + second;
   return true;
 }
 
@@ -314,6 +343,53 @@ Bool FunctionParsingHandler::processMemberModifier(
 }
 
 
+Bool FunctionParsingHandler::processOptimizationModifier(
+  Core::Processing::ParserState *state, TioSharedPtr const &modifierData
+) {
+  // Look for inline, noinline, hot, cold, or pure modifiers.
+  auto identifier = modifierData.ti_cast_get<Core::Data::Ast::Identifier>();
+  if (identifier == 0) return false;
+  auto symbolDef = state->refTopProdLevel().getProd();
+  auto keyword = symbolDef->getTranslatedModifierKeyword(identifier->getValue().get());
+
+  if (
+    keyword != S("inline") && keyword != S("noinline") && keyword != S("hot") && keyword != S("cold") &&
+    keyword != S("pure")
+  ) {
+    return false;
+  }
+
+  // Find the function to update.
+  Int levelOffset = -state->getTopProdTermLevelCount();
+
+  TiObject *data = state->getData(levelOffset).get();
+  if (data == 0) return false;
+
+  // Grab the data from the definition, if any, otherwise use the data from the state level.
+  if (data->isDerivedFrom<Core::Data::Ast::Definition>()) {
+    data = static_cast<Core::Data::Ast::Definition*>(data)->getTarget().get();
+  }
+
+  if (data->isDerivedFrom<Spp::Ast::Template>()) {
+    auto tpl = static_cast<Spp::Ast::Template*>(data);
+    data = tpl->getBody().get();
+  }
+
+  // Function types (function pointers) have no function to attach these attributes to.
+  auto function = ti_cast<Spp::Ast::Function>(data);
+  if (function == 0) return false;
+
+  // Conflicting modifiers (like inline and noinline) override each other.
+  if (keyword == S("inline")) function->setInlining(Spp::Ast::FunctionInlining::ALWAYS);
+  else if (keyword == S("noinline")) function->setInlining(Spp::Ast::FunctionInlining::NEVER);
+  else if (keyword == S("hot")) function->setHotness(Spp::Ast::FunctionHotness::HOT);
+  else if (keyword == S("cold")) function->setHotness(Spp::Ast::FunctionHotness::COLD);
+  else function->setPure(true);
+
+  return true;
+}
+
+
 Bool FunctionParsingHandler::processUnknownModifier(
   Core::Processing::ParserState *state, TioSharedPtr const &modifierData
 ) {
@@ -58,10 +58,16 @@ class FunctionParsingHandler : public Core::Processing::Handlers::GenericParsing
     Core::Processing::ParserState *state, TioSharedPtr const &modifierData
   );
 
+  private: Bool processOptimizationModifier(
+    Core::Processing::ParserState *state, TioSharedPtr const &modifierData
+  );
+
   private: Bool processUnknownModifier(
     Core::Processing::ParserState *state, TioSharedPtr const &modifierData
   );
 
+  private: Bool getModifierParamName(TiObject *param, Str &name);
+
 }; // class
 
 } // namespace
@@ -124,6 +124,13 @@ void TypeHandlersParsingHandler::onProdEnd(Processing::Parser *parser, Processin
       state->addNotice(newSrdObj<Spp::Notices::PtrBasedInitOpNotice>(exprMetadata->findSourceLocation()));
       success = false;
     }
+  } else if (expr->isDerivedFrom<Spp::Ast::MoveOp>()) {
+    if (mode == Mode::FUNCTION) {
+      success = this->createMoveOpHandler(state, static_cast<Spp::Ast::MoveOp*>(expr), body);
+    } else {
+      state->addNotice(newSrdObj<Spp::Notices::InvalidMoveOpHandlerNotice>(exprMetadata->findSourceLocation()));
+      success = false;
+    }
   } else if (expr->isDerivedFrom<Spp::Ast::TerminateOp>()) {
     success = this->createTerminateOpHandler(state, static_cast<Spp::Ast::TerminateOp*>(expr), body, mode);
   } else if (expr->isDerivedFrom<Spp::Ast::CastOp>()) {
@@ -354,6 +361,40 @@ Bool TypeHandlersParsingHandler::createInitOpHandler(
 }
 
 
+Bool TypeHandlersParsingHandler::createMoveOpHandler(
+  Processing::ParserState *state, Spp::Ast::MoveOp *moveOp,
+  SharedPtr<Spp::Ast::Block> const &body
+) {
+  // Verify operand.
+  auto operand = moveOp->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+  if (operand == 0 || operand->getValue() != S("this")) {
+    state->addNotice(newSrdObj<Spp::Notices::OpTargetNotThisNotice>(moveOp->findSourceLocation()));
+    return false;
+  }
+
+  // Prepare the source param. Move ops take exactly one arg, the value being moved.
+  auto param = moveOp->getParam();
+  if (param == 0 || param->isDerivedFrom<Core::Data::Ast::List>()) {
+    state->addNotice(newSrdObj<Spp::Notices::InvalidMoveOpHandlerNotice>(moveOp->findSourceLocation()));
+    return false;
+  }
+  auto argTypes = Core::Data::Ast::Map::create();
+  auto thisType = this->prepareThisType(operand->findSourceLocation());
+  argTypes->add(S("this"), thisType);
+  Char const *inputName;
+  TioSharedPtr inputType;
+  if (!this->prepareInputArg(state, param, inputName, inputType)) return false;
+  argTypes->add(inputName, inputType);
+
+  auto def = this->createFunction(
+    state, S("~move"), S("~move"), true, argTypes, TioSharedPtr::null, body, moveOp->findSourceLocation(),
+    Mode::FUNCTION
+  );
+  state->setData(def);
+  return true;
+}
+
+
 Bool TypeHandlersParsingHandler::createTerminateOpHandler(
   Processing::ParserState *state, Spp::Ast::TerminateOp *terminateOp,
   SharedPtr<Spp::Ast::Block> const &body, Mode mode
@@ -774,6 +815,7 @@ Bool TypeHandlersParsingHandler::processExpnameModifier(
   if (function == 0) return false;
 
   function->setName(param->getValue());
+  function->setExported(true);
   return true;
 }
 
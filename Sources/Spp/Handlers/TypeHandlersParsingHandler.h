@@ -71,6 +71,11 @@ class TypeHandlersParsingHandler : public Core::Processing::Handlers::GenericPar
     SharedPtr<Spp::Ast::Block> const &body
   );
 
+  private: Bool createMoveOpHandler(
+    Processing::ParserState *state, Spp::Ast::MoveOp *moveOp,
+    SharedPtr<Spp::Ast::Block> const &body
+  );
+
   private: Bool createTerminateOpHandler(
     Processing::ParserState *state, Spp::Ast::TerminateOp *terminateOp,
     SharedPtr<Spp::Ast::Block> const &body, Mode mode
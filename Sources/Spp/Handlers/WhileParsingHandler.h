@@ -61,6 +61,21 @@ class WhileParsingHandler : public Core::Processing::Handlers::GenericParsingHan
     state->setData(newObj);
   }
 
+  public: virtual Bool onIncomingModifier(
+    Core::Processing::Parser *parser, Core::Processing::ParserState *state,
+    TioSharedPtr const &modifierData, Bool prodProcessingComplete
+  ) {
+    if (!prodProcessingComplete) return false;
+    if (!isLoopHintModifier(state, modifierData.get())) return false;
+
+    Int levelOffset = -state->getTopProdTermLevelCount();
+    auto statement = state->getData(levelOffset).ti_cast_get<Spp::Ast::WhileStatement>();
+    if (statement == 0) return false;
+    Core::Data::Ast::translateModifier(state->refTopProdLevel().getProd(), modifierData.get());
+    statement->addModifier(modifierData);
+    return true;
+  }
+
 }; // class
 
 } } // namespace
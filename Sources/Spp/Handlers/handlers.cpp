@@ -122,6 +122,24 @@ Bool parseNumber(
 }
 
 
+Bool isLoopHintModifier(Core::Processing::ParserState *state, TiObject *modifierData)
+{
+  // Loop hints are either plain identifiers like `@no_vectorize` or identifiers with params like `@unroll[4]`.
+  Core::Data::Ast::Identifier *identifier = ti_cast<Core::Data::Ast::Identifier>(modifierData);
+  if (identifier == 0) {
+    auto paramPass = ti_cast<Core::Data::Ast::ParamPass>(modifierData);
+    if (paramPass == 0 || paramPass->getType() != Core::Data::Ast::BracketType::SQUARE) return false;
+    identifier = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+    if (identifier == 0) return false;
+  }
+  auto symbolDef = state->refTopProdLevel().getProd();
+  auto keyword = symbolDef->getTranslatedModifierKeyword(identifier->getValue().get());
+  return
+    keyword == S("unroll") || keyword == S("no_unroll") || keyword == S("vectorize") ||
+    keyword == S("no_vectorize") || keyword == S("parallel_safe");
+}
+
+
 Bool parseTemplateArgs(
   Processing::ParserState *state, Core::Data::Ast::Bracket *bracket, SharedPtr<Core::Data::Ast::List> &result
 ) {
@@ -31,6 +31,9 @@ Bool parseNumber(
   TiObject *ast, TiWord &result, Core::Data::Ast::MetaHaving *parentMetadata, Core::Notices::Store *noticeStore
 );
 
+/// @ingroup spp_handlers
+Bool isLoopHintModifier(Core::Processing::ParserState *state, TiObject *modifierData);
+
 /// @ingroup spp_handlers
 Bool parseTemplateArgs(
   Processing::ParserState *state, Core::Data::Ast::Bracket *bracket, SharedPtr<Core::Data::Ast::List> &result
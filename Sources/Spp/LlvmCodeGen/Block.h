@@ -18,6 +18,8 @@ namespace Spp::LlvmCodeGen
 
 class Block : public TiObject
 {
+  friend class TargetGenerator;
+
   //============================================================================
   // Type Info
 
@@ -36,6 +38,8 @@ class Block : public TiObject
 
   private: Bool terminated;
 
+  private: llvm::SwitchInst *llvmExitSwitch = 0;
+
 
   //============================================================================
   // Constructor & Destructor
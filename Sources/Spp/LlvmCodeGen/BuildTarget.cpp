@@ -34,4 +34,119 @@ llvm::Type* BuildTarget::getVaListType()
   return this->vaListType;
 }
 
+
+llvm::DIBuilder* BuildTarget::getDiBuilder()
+{
+  auto module = this->getGlobalLlvmModule();
+  if (this->diBuilder == 0 || this->diModule != module) {
+    this->resetDebugInfo();
+    this->diBuilder = std::make_unique<llvm::DIBuilder>(*module);
+    this->diModule = module;
+    module->addModuleFlag(llvm::Module::Warning, "Debug Info Version", llvm::DEBUG_METADATA_VERSION);
+    module->addModuleFlag(llvm::Module::Warning, "Dwarf Version", 4);
+  }
+  return this->diBuilder.get();
+}
+
+
+llvm::DIFile* BuildTarget::getDiFile(Char const *filename)
+{
+  auto diBuilder = this->getDiBuilder();
+  auto it = this->diFiles.find(filename);
+  if (it != this->diFiles.end()) return it->second;
+
+  auto diFile = diBuilder->createFile(llvm::sys::path::filename(filename), llvm::sys::path::parent_path(filename));
+  this->diFiles[filename] = diFile;
+  if (this->diCompileUnit == 0) {
+    // DWARF has no language code for Alusus, so C is used to keep debuggers showing names as they are.
+    this->diCompileUnit = diBuilder->createCompileUnit(
+      llvm::dwarf::DW_LANG_C, diFile, "Alusus", this->isOptimizing(), "", 0, llvm::StringRef(),
+      this->debugInfoLevel == DebugInfoLevel::FULL ?
+        llvm::DICompileUnit::FullDebug : llvm::DICompileUnit::LineTablesOnly
+    );
+  }
+  return diFile;
+}
+
+
+llvm::DIType* BuildTarget::getDiType(Type *type)
+{
+  auto it = this->diTypes.find(type);
+  if (it != this->diTypes.end()) return it->second;
+
+  auto diBuilder = this->getDiBuilder();
+  auto dataLayout = this->getLlvmDataLayout();
+  llvm::DIType *diType = 0;
+  if (type->isDerivedFrom<IntegerType>()) {
+    auto integerType = static_cast<IntegerType*>(type);
+    Word size = integerType->getSize();
+    Str name = Str(integerType->isSigned() ? S("Int[") : S("Word[")) + (LongInt)size + S("]");
+    diType = diBuilder->createBasicType(
+      name.getBuf(), size,
+      size == 1 ? llvm::dwarf::DW_ATE_boolean :
+        integerType->isSigned() ? llvm::dwarf::DW_ATE_signed : llvm::dwarf::DW_ATE_unsigned
+    );
+  } else if (type->isDerivedFrom<FloatType>()) {
+    Word size = static_cast<FloatType*>(type)->getSize();
+    Str name = Str(S("Float[")) + (LongInt)size + S("]");
+    diType = diBuilder->createBasicType(name.getBuf(), size, llvm::dwarf::DW_ATE_float);
+  } else if (type->isDerivedFrom<PointerType>()) {
+    auto contentType = static_cast<PointerType*>(type)->getContentType();
+    diType = diBuilder->createPointerType(
+      contentType == 0 ? 0 : this->getDiType(contentType.get()), dataLayout->getPointerSizeInBits()
+    );
+  } else if (type->isDerivedFrom<ArrayType>()) {
+    auto arrayType = static_cast<ArrayType*>(type);
+    auto llvmType = arrayType->getLlvmType();
+    llvm::Metadata *subscripts[] = { diBuilder->getOrCreateSubrange(0, arrayType->getSize()) };
+    diType = diBuilder->createArrayType(
+      dataLayout->getTypeAllocSizeInBits(llvmType), dataLayout->getABITypeAlignment(llvmType) * 8,
+      this->getDiType(arrayType->getContentType().get()), diBuilder->getOrCreateArray(subscripts)
+    );
+  } else if (type->isDerivedFrom<VectorType>()) {
+    auto vectorType = static_cast<VectorType*>(type);
+    auto llvmType = vectorType->getLlvmType();
+    llvm::Metadata *subscripts[] = { diBuilder->getOrCreateSubrange(0, vectorType->getSize()) };
+    diType = diBuilder->createVectorType(
+      dataLayout->getTypeAllocSizeInBits(llvmType), dataLayout->getABITypeAlignment(llvmType) * 8,
+      this->getDiType(vectorType->getElementType().get()), diBuilder->getOrCreateArray(subscripts)
+    );
+  } else if (type->isDerivedFrom<StructType>()) {
+    auto structType = static_cast<StructType*>(type);
+    auto llvmType = llvm::cast<llvm::StructType>(structType->getLlvmType());
+    if (llvmType->isSized()) {
+      diType = diBuilder->createStructType(
+        this->diCompileUnit, structType->getName().getBuf(), 0, 0, dataLayout->getTypeAllocSizeInBits(llvmType),
+        dataLayout->getABITypeAlignment(llvmType) * 8, llvm::DINode::FlagZero, 0, diBuilder->getOrCreateArray({})
+      );
+    } else {
+      diType = diBuilder->createStructType(
+        this->diCompileUnit, structType->getName().getBuf(), 0, 0, 0, 0, llvm::DINode::FlagFwdDecl, 0,
+        diBuilder->getOrCreateArray({})
+      );
+    }
+  } else if (type->isDerivedFrom<FunctionType>()) {
+    diType = diBuilder->createSubroutineType(diBuilder->getOrCreateTypeArray({}));
+  }
+  this->diTypes[type] = diType;
+  return diType;
+}
+
+
+void BuildTarget::finalizeDebugInfo()
+{
+  if (this->diBuilder != 0) this->diBuilder->finalize();
+  this->resetDebugInfo();
+}
+
+
+void BuildTarget::resetDebugInfo()
+{
+  this->diBuilder.reset();
+  this->diModule = 0;
+  this->diCompileUnit = 0;
+  this->diFiles.clear();
+  this->diTypes.clear();
+}
+
 } // namespace
@@ -23,11 +23,28 @@ class BuildTarget : public TiObject
 
   TYPE_INFO(BuildTarget, TiObject, "Spp.LlvmCodeGen", "Spp", "alusus.org");
 
+
+  //============================================================================
+  // Types
+
+  public: s_enum(DebugInfoLevel, NONE, LINE_TABLES, FULL);
+
+
   //============================================================================
   // Member Variables
 
   private: llvm::StructType *vaListType = 0;
 
+  /// How much source level debug info is generated for the built code.
+  private: DebugInfoLevel debugInfoLevel = DebugInfoLevel::NONE;
+
+  /// The debug info builder of the global module. Recreated whenever the global module changes.
+  private: std::unique_ptr<llvm::DIBuilder> diBuilder;
+  private: llvm::Module *diModule = 0;
+  private: llvm::DICompileUnit *diCompileUnit = 0;
+  private: std::map<std::string, llvm::DIFile*> diFiles;
+  private: std::map<Type*, llvm::DIType*> diTypes;
+
 
   //============================================================================
   // Member Functions
@@ -35,6 +52,7 @@ class BuildTarget : public TiObject
   public: virtual void setupBuild()
   {
     this->vaListType = 0;
+    this->resetDebugInfo();
   }
 
   public: virtual llvm::DataLayout* getLlvmDataLayout() = 0;
@@ -50,8 +68,45 @@ class BuildTarget : public TiObject
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module) = 0;
 
+  /// Whether the generated code goes through optimization passes. Hints that only
+  /// help the optimizer, like variable lifetime markers, are skipped otherwise.
+  public: virtual Bool isOptimizing()
+  {
+    return true;
+  }
+
+  /// Marks a symbol as one that must stay visible outside the generated program.
+  public: virtual void addExportedSymbol(llvm::StringRef name)
+  {
+  }
+
   public: virtual llvm::Type* getVaListType();
 
+  public: void setDebugInfoLevel(DebugInfoLevel level)
+  {
+    this->debugInfoLevel = level;
+  }
+
+  public: DebugInfoLevel getDebugInfoLevel() const
+  {
+    return this->debugInfoLevel;
+  }
+
+  /// Returns the debug info builder of the global module, creating it if needed.
+  public: llvm::DIBuilder* getDiBuilder();
+
+  /// Returns the debug info file of the given source file. The compile unit of the global module is created along
+  /// with the first file.
+  public: llvm::DIFile* getDiFile(Char const *filename);
+
+  /// Returns the debug info type of the given type. Struct members are not described.
+  public: llvm::DIType* getDiType(Type *type);
+
+  /// Finalizes the debug info of the global module. Must be called before the module is compiled.
+  public: void finalizeDebugInfo();
+
+  private: void resetDebugInfo();
+
 }; // class
 
 } // namespace
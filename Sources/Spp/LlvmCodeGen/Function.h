@@ -32,7 +32,10 @@ class Function : public TiObject
   private: Str name;
   private: FunctionType *functionType;
   private: llvm::Function *llvmFunction;
+  private: Word attributes = 0;
   private: llvm::AllocaInst *llvmVaList = 0;
+  private: llvm::AllocaInst *llvmLastEntryAlloca = 0;
+  private: llvm::AllocaInst *llvmCleanupSelector = 0;
   private: std::unique_ptr<llvm::Module> llvmModule;
 
 
@@ -79,6 +82,15 @@ class Function : public TiObject
     return this->llvmFunction;
   }
 
+  public: void setAttributes(Word attrs)
+  {
+    this->attributes = attrs;
+  }
+  public: Word getAttributes() const
+  {
+    return this->attributes;
+  }
+
 }; // class
 
 } // namespace
@@ -15,13 +15,62 @@
 namespace Spp::LlvmCodeGen
 {
 
+void JitBuildTarget::setCompileThreadCount(Word count)
+{
+  this->compileThreadCount = count;
+  if (this->llvmJitEngine != 0) this->llvmJitEngine->setNumCompileThreads(count);
+}
+
+
+void JitBuildTarget::setTierUpThreshold(Word threshold)
+{
+  this->tierUpThreshold = threshold;
+  if (this->llvmJitEngine != 0) this->llvmJitEngine->setTierUpThreshold(threshold);
+}
+
+
+void JitBuildTarget::setObjectCacheEnabled(Bool enabled)
+{
+  this->objectCacheEnabled = enabled;
+  if (this->objectCache != 0) this->objectCache->setEnabled(enabled);
+}
+
+
+void JitBuildTarget::setObjectCacheSizeLimit(Word limit)
+{
+  this->objectCacheSizeLimit = limit;
+  if (this->objectCache != 0) this->objectCache->setSizeLimit(limit);
+}
+
+
 void JitBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder().create(this->globalItemRepo));
+  // The cache key depends on the target machine, so the engine and the cache share the same one.
+  auto jtmb = llvm::cantFail(llvm::orc::JITTargetMachineBuilder::detectHost());
+  this->objectCache = std::make_unique<JitObjectCache>(jtmb, this->objectCacheEnabled, this->objectCacheSizeLimit);
+
+  JitEngineBuilder builder;
+  builder
+    .setJITTargetMachineBuilder(jtmb)
+    .setNumCompileThreads(this->compileThreadCount)
+    .setObjectCache(this->objectCache.get());
+  if (this->perfMapEnabled) builder.addEventListener(JitPerfMapListener::getSingleton());
+  if (this->jitDumpEnabled) {
+    // LLVM only provides the jitdump listener when built with perf support.
+    auto jitDumpListener = llvm::JITEventListener::createPerfJITEventListener();
+    if (jitDumpListener != 0) builder.addEventListener(jitDumpListener);
+    else llvm::errs() << "JIT dump is not supported by this build of LLVM.\n";
+  }
+  // Let debuggers find the debug info of compiled code.
+  if (this->getDebugInfoLevel() != DebugInfoLevel::NONE) {
+    builder.addEventListener(llvm::JITEventListener::createGDBRegistrationListener());
+  }
+  this->llvmJitEngine = llvm::cantFail(builder.create(this->globalItemRepo));
+  this->llvmJitEngine->setTierUpThreshold(this->tierUpThreshold);
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -68,7 +117,26 @@ void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 
 void JitBuildTarget::execute(Char const *entry)
 {
-  if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
+  if (this->llvmModule != 0) {
+    this->finalizeDebugInfo();
+    if (this->compileThreadCount > 1) {
+      // Split the program into partitions that are added separately so the JIT engine can compile them in parallel.
+      // Local symbols are kept with their users to avoid renaming them.
+      llvm::SplitModule(
+        std::move(this->llvmModule), this->compileThreadCount,
+        [=](std::unique_ptr<llvm::Module> partition) {
+          // Skip partitions that ended up with declarations only.
+          auto globals = partition->global_values();
+          if (std::any_of(globals.begin(), globals.end(), [](llvm::GlobalValue &gv) { return !gv.isDeclaration(); })) {
+            this->addLlvmModule(std::move(partition));
+          }
+        },
+        true
+      );
+    } else {
+      this->addLlvmModule(std::move(this->llvmModule));
+    }
+  }
 
   typedef void (*FuncType)();
   auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
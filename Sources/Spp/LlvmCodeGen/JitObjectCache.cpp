@@ -0,0 +1,121 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::LlvmCodeGen
+{
+
+//==============================================================================
+// Constructor & Destructor
+
+JitObjectCache::JitObjectCache(llvm::orc::JITTargetMachineBuilder const &jtmb, Bool enabled, Word sizeLimit)
+  : directory(JitObjectCache::getDefaultDirectory()), enabled(false), sizeLimit(sizeLimit)
+{
+  // Anything that affects the generated code, other than the IR itself, goes into the key.
+  llvm::raw_string_ostream salt(this->keySalt);
+  salt << LLVM_VERSION_STRING << ';' << jtmb.getTargetTriple().str() << ';' << jtmb.getCPU() << ';'
+    << jtmb.getFeatures().getString() << ';';
+  salt.flush();
+
+  this->setEnabled(enabled);
+}
+
+
+//==============================================================================
+// Member Functions
+
+void JitObjectCache::setEnabled(Bool enabled)
+{
+  // The cache stays disabled if there is no usable cache directory.
+  this->enabled = enabled && !this->directory.empty() && !llvm::sys::fs::create_directories(this->directory);
+  if (this->enabled) this->prune();
+}
+
+
+void JitObjectCache::setSizeLimit(Word limit)
+{
+  this->sizeLimit = limit;
+  if (this->enabled) this->prune();
+}
+
+
+void JitObjectCache::prune()
+{
+  if (!this->enabled) return;
+  llvm::CachePruningPolicy policy;
+  policy.MaxSizeBytes = this->sizeLimit;
+  llvm::pruneCache(this->directory, policy);
+}
+
+
+void JitObjectCache::notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj)
+{
+  if (!this->enabled) return;
+  auto filename = this->getFilename(module);
+
+  // Write into a temp file first then rename it so that other processes never see a partial object.
+  Int fd;
+  llvm::SmallString<256> tempFilename;
+  if (llvm::sys::fs::createUniqueFile(this->directory + "/tmp-%%%%%%%%%%%%", fd, tempFilename)) return;
+  {
+    llvm::raw_fd_ostream out(fd, true);
+    out << obj.getBuffer();
+    out.close();
+    if (out.has_error()) {
+      out.clear_error();
+      llvm::sys::fs::remove(tempFilename);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tempFilename, filename)) llvm::sys::fs::remove(tempFilename);
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(llvm::Module const *module)
+{
+  if (!this->enabled) return nullptr;
+  auto filename = this->getFilename(module);
+
+  Int fd;
+  if (llvm::sys::fs::openFileForRead(filename, fd)) return nullptr;
+  // Pruning drops the least recently used files first, so mark this one as used.
+  llvm::sys::fs::setLastAccessAndModificationTime(fd, std::chrono::system_clock::now());
+  // Not requiring a null terminator lets the file get memory mapped.
+  auto buffer = llvm::MemoryBuffer::getOpenFile(fd, filename, -1, false);
+  llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  if (!buffer) return nullptr;
+  return std::move(*buffer);
+}
+
+
+std::string JitObjectCache::getFilename(llvm::Module const *module)
+{
+  llvm::SmallVector<char, 0> bitcode;
+  llvm::raw_svector_ostream stream(bitcode);
+  stream << this->keySalt;
+  llvm::WriteBitcodeToFile(*module, stream);
+  auto hash = llvm::SHA1::hash(llvm::arrayRefFromStringRef(stream.str()));
+  // The llvmcache- prefix is what pruneCache recognizes as cache files.
+  return this->directory + "/llvmcache-" + llvm::toHex(hash);
+}
+
+
+std::string JitObjectCache::getDefaultDirectory()
+{
+  llvm::SmallString<256> path;
+  if (!llvm::sys::path::cache_directory(path)) return std::string();
+  llvm::sys::path::append(path, "alusus", "jit");
+  return path.str().str();
+}
+
+} // namespace
@@ -0,0 +1,86 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.h
+ * Contains the header of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+#define SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief An on-disk cache for the object code generated by the JIT engines.
+ * @ingroup spp_llvmcodegen
+ *
+ * Objects are keyed by a hash of the module's bitcode along with the target
+ * triple, CPU, features and LLVM version, so a module
+ * that did not change between runs is loaded from disk instead of going
+ * through code generation again. Cached files are memory mapped when loaded.
+ * The cache directory is pruned to the given size limit, dropping least
+ * recently used files first.
+ */
+class JitObjectCache : public llvm::ObjectCache
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::string directory;
+  private: std::string keySalt;
+  private: std::atomic<Bool> enabled;
+  private: Word sizeLimit;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: JitObjectCache(llvm::orc::JITTargetMachineBuilder const &jtmb, Bool enabled, Word sizeLimit);
+
+
+  //============================================================================
+  // Member Functions
+
+  public: std::string const& getDirectory() const
+  {
+    return this->directory;
+  }
+
+  /// Enables or disables the cache. Enabling it creates the cache directory and prunes it.
+  public: void setEnabled(Bool enabled);
+
+  public: Bool isEnabled() const
+  {
+    return this->enabled;
+  }
+
+  public: void setSizeLimit(Word limit);
+
+  public: Word getSizeLimit() const
+  {
+    return this->sizeLimit;
+  }
+
+  /// Removes expired files and least recently used files beyond the size limit.
+  public: void prune();
+
+  public: virtual void notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj);
+
+  public: virtual std::unique_ptr<llvm::MemoryBuffer> getObject(llvm::Module const *module);
+
+  private: std::string getFilename(llvm::Module const *module);
+
+  /// Returns the default cache directory, which is alusus/jit under the user's cache directory.
+  public: static std::string getDefaultDirectory();
+
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file Spp/LlvmCodeGen/JitPerfMapListener.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitPerfMapListener.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::LlvmCodeGen
+{
+
+//==============================================================================
+// Constructor & Destructor
+
+JitPerfMapListener::JitPerfMapListener()
+{
+  std::error_code error;
+  this->stream = std::make_unique<llvm::raw_fd_ostream>(
+    JitPerfMapListener::getFilename(), error, llvm::sys::fs::OF_Text
+  );
+  if (error) {
+    llvm::errs() << "Failed to open the perf map file: " << error.message() << "\n";
+    this->stream.reset();
+  }
+}
+
+
+//==============================================================================
+// Member Functions
+
+JitPerfMapListener* JitPerfMapListener::getSingleton()
+{
+  static JitPerfMapListener listener;
+  return &listener;
+}
+
+
+std::string JitPerfMapListener::getFilename()
+{
+  return "/tmp/perf-" + std::to_string(llvm::sys::Process::getProcessId()) + ".map";
+}
+
+
+void JitPerfMapListener::notifyObjectLoaded(
+  ObjectKey key, llvm::object::ObjectFile const &obj, llvm::RuntimeDyld::LoadedObjectInfo const &info
+) {
+  if (this->stream == 0) return;
+
+  // The debug copy of the object has its sections relocated to the addresses they were loaded at.
+  auto debugObj = info.getObjectForDebug(obj);
+  if (debugObj.getBinary() == 0) return;
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  for (auto const &symbolSize : llvm::object::computeSymbolSizes(*debugObj.getBinary())) {
+    auto symbol = symbolSize.first;
+    auto type = symbol.getType();
+    if (!type) {
+      llvm::consumeError(type.takeError());
+      continue;
+    }
+    if (*type != llvm::object::SymbolRef::ST_Function || symbolSize.second == 0) continue;
+    auto name = symbol.getName();
+    if (!name) {
+      llvm::consumeError(name.takeError());
+      continue;
+    }
+    auto address = symbol.getAddress();
+    if (!address) {
+      llvm::consumeError(address.takeError());
+      continue;
+    }
+    *this->stream << llvm::format_hex_no_prefix(*address, 1) << ' '
+      << llvm::format_hex_no_prefix(symbolSize.second, 1) << ' ' << *name << '\n';
+  }
+  this->stream->flush();
+}
+
+} // namespace
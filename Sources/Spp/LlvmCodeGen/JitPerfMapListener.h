@@ -0,0 +1,59 @@
+/**
+ * @file Spp/LlvmCodeGen/JitPerfMapListener.h
+ * Contains the header of class Spp::LlvmCodeGen::JitPerfMapListener.
+ *
+ * @copyright Copyright (C) 2023 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITPERFMAPLISTENER_H
+#define SPP_LLVMCODEGEN_JITPERFMAPLISTENER_H
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief Writes the addresses of JIT compiled functions to a perf map file.
+ * @ingroup spp_llvmcodegen
+ *
+ * Profilers like perf look up the names of functions in anonymous executable
+ * memory in /tmp/perf-<pid>.map. This listener appends a line to that file for
+ * every function in every object loaded by the JIT engines, using the function
+ * names given by the code generator. A single instance is shared by all the
+ * engines in the process so that they all write to the same file.
+ */
+class JitPerfMapListener : public llvm::JITEventListener
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::mutex mutex;
+  private: std::unique_ptr<llvm::raw_fd_ostream> stream;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  private: JitPerfMapListener();
+
+
+  //============================================================================
+  // Member Functions
+
+  public: static JitPerfMapListener* getSingleton();
+
+  public: static std::string getFilename();
+
+  public: virtual void notifyObjectLoaded(
+    ObjectKey key, llvm::object::ObjectFile const &obj, llvm::RuntimeDyld::LoadedObjectInfo const &info
+  );
+
+}; // class
+
+} // namespace
+
+#endif
@@ -15,13 +15,50 @@
 namespace Spp::LlvmCodeGen
 {
 
+void LazyJitBuildTarget::setCompileThreadCount(Word count)
+{
+  this->compileThreadCount = count;
+  if (this->llvmJitEngine != 0) this->llvmJitEngine->setNumCompileThreads(count);
+}
+
+
+void LazyJitBuildTarget::setObjectCacheEnabled(Bool enabled)
+{
+  this->objectCacheEnabled = enabled;
+  if (this->objectCache != 0) this->objectCache->setEnabled(enabled);
+}
+
+
+void LazyJitBuildTarget::setObjectCacheSizeLimit(Word limit)
+{
+  this->objectCacheSizeLimit = limit;
+  if (this->objectCache != 0) this->objectCache->setSizeLimit(limit);
+}
+
+
 void LazyJitBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(LazyJitEngineBuilder().create(this->globalItemRepo));
+  // The cache key depends on the target machine, so the engine and the cache share the same one.
+  auto jtmb = llvm::cantFail(llvm::orc::JITTargetMachineBuilder::detectHost());
+  this->objectCache = std::make_unique<JitObjectCache>(jtmb, this->objectCacheEnabled, this->objectCacheSizeLimit);
+
+  LazyJitEngineBuilder builder;
+  builder
+    .setJITTargetMachineBuilder(jtmb)
+    .setNumCompileThreads(this->compileThreadCount)
+    .setObjectCache(this->objectCache.get());
+  if (this->perfMapEnabled) builder.addEventListener(JitPerfMapListener::getSingleton());
+  if (this->jitDumpEnabled) {
+    // LLVM only provides the jitdump listener when built with perf support.
+    auto jitDumpListener = llvm::JITEventListener::createPerfJITEventListener();
+    if (jitDumpListener != 0) builder.addEventListener(jitDumpListener);
+    else llvm::errs() << "JIT dump is not supported by this build of LLVM.\n";
+  }
+  this->llvmJitEngine = llvm::cantFail(builder.create(this->globalItemRepo));
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -27,6 +27,8 @@ class LazyJitBuildTarget : public BuildTarget
   //============================================================================
   // Member Variables
 
+  /// The cache of compiled objects. Declared before the engine so that it outlives it.
+  private: std::unique_ptr<JitObjectCache> objectCache;
   private: std::unique_ptr<LazyJitEngine> llvmJitEngine;
   private: std::unique_ptr<llvm::orc::ThreadSafeContext> llvmTsContext;
   private: llvm::LLVMContext *llvmContext = 0;
@@ -35,6 +37,21 @@ class LazyJitBuildTarget : public BuildTarget
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
 
+  /// The number of threads used by the JIT engine to compile modules in parallel.
+  private: Word compileThreadCount = 0;
+
+  /// Whether compiled objects are stored in and loaded from the on-disk cache.
+  private: Bool objectCacheEnabled = true;
+
+  /// The maximum size in bytes of the on-disk object cache.
+  private: Word objectCacheSizeLimit = 512 * 1024 * 1024;
+
+  /// Whether the names of compiled functions are written to a perf map file for profilers.
+  private: Bool perfMapEnabled = false;
+
+  /// Whether compiled code is written to a jitdump file for perf.
+  private: Bool jitDumpEnabled = false;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -54,6 +71,49 @@ class LazyJitBuildTarget : public BuildTarget
   //============================================================================
   // Member Functions
 
+  public: void setCompileThreadCount(Word count);
+
+  public: Word getCompileThreadCount() const
+  {
+    return this->compileThreadCount;
+  }
+
+  public: void setObjectCacheEnabled(Bool enabled);
+
+  public: Bool isObjectCacheEnabled() const
+  {
+    return this->objectCacheEnabled;
+  }
+
+  public: void setObjectCacheSizeLimit(Word limit);
+
+  public: Word getObjectCacheSizeLimit() const
+  {
+    return this->objectCacheSizeLimit;
+  }
+
+  /// Takes effect when the JIT engine is created in the next setupBuild call.
+  public: void setPerfMapEnabled(Bool enabled)
+  {
+    this->perfMapEnabled = enabled;
+  }
+
+  public: Bool isPerfMapEnabled() const
+  {
+    return this->perfMapEnabled;
+  }
+
+  /// Takes effect when the JIT engine is created in the next setupBuild call.
+  public: void setJitDumpEnabled(Bool enabled)
+  {
+    this->jitDumpEnabled = enabled;
+  }
+
+  public: Bool isJitDumpEnabled() const
+  {
+    return this->jitDumpEnabled;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -31,6 +31,9 @@ class LoopContext : public CodeGen::LoopTgContext
   private: SharedPtr<Block> updaterBlock;
   private: SharedPtr<Block> bodyBlock;
   private: SharedPtr<Block> exitBlock;
+  private: Word hints = 0;
+  private: Word unrollCount = 0;
+  private: Word vectorizeWidth = 0;
 
 
   //============================================================================
@@ -99,6 +102,28 @@ class LoopContext : public CodeGen::LoopTgContext
     return this->exitBlock;
   }
 
+  public: void setHints(Word h, Word uc, Word vw)
+  {
+    this->hints = h;
+    this->unrollCount = uc;
+    this->vectorizeWidth = vw;
+  }
+
+  public: Word getHints() const
+  {
+    return this->hints;
+  }
+
+  public: Word getUnrollCount() const
+  {
+    return this->unrollCount;
+  }
+
+  public: Word getVectorizeWidth() const
+  {
+    return this->vectorizeWidth;
+  }
+
 }; // class
 
 } } // namespace
@@ -15,31 +15,81 @@
 namespace Spp::LlvmCodeGen
 {
 
+void OfflineBuildTarget::setTargetCpu(Char const *cpu)
+{
+  this->targetCpu = cpu == 0 ? "generic" : cpu;
+  if (this->llvmTarget != 0) this->targetMachine = this->createTargetMachine();
+}
+
+
+void OfflineBuildTarget::setTargetFeatures(Char const *features)
+{
+  this->targetFeatures = features == 0 ? "" : features;
+  if (this->llvmTarget != 0) this->targetMachine = this->createTargetMachine();
+}
+
+
+void OfflineBuildTarget::setCodeGenFlags(Array<Str> const *flags)
+{
+  if (flags == 0) return;
+
+  // Only code generation flags are handled here; other flags (linker flags for example) are ignored.
+  for (Int i = 0; i < flags->getLength(); ++i) {
+    Str const &flag = flags->at(i);
+    if (flag == S("-O0")) this->setOptimizationLevel(OptimizationLevel::O0);
+    else if (flag == S("-O1")) this->setOptimizationLevel(OptimizationLevel::O1);
+    else if (flag == S("-O2")) this->setOptimizationLevel(OptimizationLevel::O2);
+    else if (flag == S("-O3")) this->setOptimizationLevel(OptimizationLevel::O3);
+    else if (flag == S("-Os")) this->setOptimizationLevel(OptimizationLevel::OS);
+    else if (flag == S("-Oz")) this->setOptimizationLevel(OptimizationLevel::OZ);
+    else if (flag.compare(S("-O"), 2) == 0) {
+      throw EXCEPTION(InvalidArgumentException, S("flags"), S("Invalid optimization level."), flag.getBuf());
+    } else if (flag.compare(S("-march="), 7) == 0) {
+      this->setTargetCpu(flag.getBuf() + 7);
+    } else if (flag.compare(S("-mcpu="), 6) == 0) {
+      this->setTargetCpu(flag.getBuf() + 6);
+    } else if (flag.compare(S("-mattr="), 7) == 0) {
+      this->setTargetFeatures(flag.getBuf() + 7);
+    } else if (flag == S("-fwhole-program")) {
+      this->setWholeProgram(true);
+    } else if (flag == S("-g")) {
+      this->setDebugInfoLevel(DebugInfoLevel::FULL);
+    } else if (flag == S("-gline-tables-only")) {
+      this->setDebugInfoLevel(DebugInfoLevel::LINE_TABLES);
+    } else if (flag == S("-g0")) {
+      this->setDebugInfoLevel(DebugInfoLevel::NONE);
+    } else if (flag == S("-fprofile-generate")) {
+      this->setProfileGenerateFilename("default.proftext");
+    } else if (flag.compare(S("-fprofile-generate="), 19) == 0) {
+      this->setProfileGenerateFilename(flag.getBuf() + 19);
+    } else if (flag == S("-fprofile-use")) {
+      this->setProfileUseFilename("default.proftext");
+    } else if (flag.compare(S("-fprofile-use="), 14) == 0) {
+      this->setProfileUseFilename(flag.getBuf() + 14);
+    }
+  }
+}
+
+
 void OfflineBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
 
   this->llvmGlobalCtorDtorEntryTypes = LlvmGlobalCtorDtorEntryTypes();
   this->llvmModule.reset();
+  this->exportedSymbols.clear();
 
   std::string error;
-  auto target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
+  this->llvmTarget = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
 
   // Print an error and exit if we couldn't find the requested target.
   // This generally occurs if we've forgotten to initialise the
   // TargetRegistry or we have a bogus target triple.
-  if (!target) {
+  if (!this->llvmTarget) {
     throw EXCEPTION(GenericException, error.c_str());
   }
 
-  auto cpu = "generic";
-  auto features = "";
-
-  llvm::TargetOptions opt;
-  auto rm = llvm::Optional<llvm::Reloc::Model>();
-  this->targetMachine = std::unique_ptr<llvm::TargetMachine>(
-    target->createTargetMachine(targetTriple, cpu, features, opt, rm)
-  );
+  this->targetMachine = this->createTargetMachine();
 
   this->llvmDataLayout = std::make_unique<llvm::DataLayout>(this->targetMachine->createDataLayout());
 
@@ -89,6 +139,10 @@ Str OfflineBuildTarget::generateLlvmIr(Array<Str> const *ctorNames, Array<Str> c
   this->buildCtorOrDtorArray(ctorNames, "llvm.global_ctors");
   this->buildCtorOrDtorArray(dtorNames, "llvm.global_dtors");
 
+  this->finalizeDebugInfo();
+  this->internalizeModule();
+  this->optimizeModule();
+
   StrStream strStream;
   llvm::raw_os_ostream ostream(strStream);
   llvm::createPrintModulePass(ostream)->runOnModule(*(this->llvmModule));
@@ -98,7 +152,7 @@ Str OfflineBuildTarget::generateLlvmIr(Array<Str> const *ctorNames, Array<Str> c
 
 
 void OfflineBuildTarget::generateObjectFile(
-  Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames
+  Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames, Array<Str> *objectFilenames
 ) {
   VALIDATE_NOT_NULL(filename);
   if (this->llvmModule == 0) {
@@ -109,6 +163,38 @@ void OfflineBuildTarget::generateObjectFile(
   this->buildCtorOrDtorArray(dtorNames, "llvm.global_dtors");
 
   this->llvmModule->setTargetTriple(this->targetTriple);
+  this->finalizeDebugInfo();
+  this->internalizeModule();
+  this->optimizeModule();
+
+  // Multiple partitions can only be generated if the caller is able to receive the list of generated files.
+  Word partitionCount = objectFilenames == 0 ? 1 : this->codeGenThreadCount;
+  if (partitionCount > 1) {
+    // Split the module and generate each partition on its own thread. Each partition is moved into its own LLVM
+    // context and the splitting is deterministic, so the same program always results in the same partitions.
+    std::vector<std::unique_ptr<llvm::raw_fd_ostream>> dests;
+    std::vector<llvm::raw_pwrite_stream*> destPtrs;
+    for (Word i = 0; i < partitionCount; ++i) {
+      Str partitionFilename = OfflineBuildTarget::getPartitionFilename(filename, i);
+      std::error_code ec;
+      dests.push_back(std::make_unique<llvm::raw_fd_ostream>(partitionFilename.getBuf(), ec, llvm::sys::fs::F_None));
+      if (ec) {
+        throw EXCEPTION(FileException, ec.message().c_str(), C('w'));
+      }
+      destPtrs.push_back(dests.back().get());
+      objectFilenames->add(partitionFilename);
+    }
+
+    llvm::splitCodeGen(
+      std::move(this->llvmModule), destPtrs, {}, [this]()->std::unique_ptr<llvm::TargetMachine> {
+        return this->createTargetMachine();
+      },
+      llvm::CGFT_ObjectFile
+    );
+
+    for (auto &dest : dests) dest->flush();
+    return;
+  }
 
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::F_None);
@@ -126,6 +212,388 @@ void OfflineBuildTarget::generateObjectFile(
 
   pass.run(*this->llvmModule);
   dest.flush();
+
+  if (objectFilenames != 0) objectFilenames->add(Str(filename));
+}
+
+
+std::unique_ptr<llvm::TargetMachine> OfflineBuildTarget::createTargetMachine() const
+{
+  std::string cpu = this->targetCpu;
+  std::string features = this->targetFeatures;
+  if (cpu == "native") {
+    cpu = llvm::sys::getHostCPUName().str();
+    llvm::SubtargetFeatures hostFeatures;
+    llvm::StringMap<bool> hostFeatureMap;
+    if (llvm::sys::getHostCPUFeatures(hostFeatureMap)) {
+      for (auto &feature : hostFeatureMap) hostFeatures.AddFeature(feature.first(), feature.second);
+    }
+    // Explicitly requested features are appended last so they override the host's features.
+    if (!features.empty()) hostFeatures.AddFeature(features);
+    features = hostFeatures.getString();
+  }
+
+  llvm::TargetOptions opt;
+  auto rm = llvm::Optional<llvm::Reloc::Model>();
+  return std::unique_ptr<llvm::TargetMachine>(this->llvmTarget->createTargetMachine(
+    this->targetTriple, cpu, features, opt, rm, llvm::Optional<llvm::CodeModel::Model>(), this->getCodeGenOptLevel()
+  ));
+}
+
+
+llvm::CodeGenOpt::Level OfflineBuildTarget::getCodeGenOptLevel() const
+{
+  switch (this->optimizationLevel.val) {
+    case OptimizationLevel::O0: return llvm::CodeGenOpt::None;
+    case OptimizationLevel::O1: return llvm::CodeGenOpt::Less;
+    case OptimizationLevel::O3: return llvm::CodeGenOpt::Aggressive;
+    default: return llvm::CodeGenOpt::Default;
+  }
+}
+
+
+void OfflineBuildTarget::internalizeModule()
+{
+  if (!this->wholeProgram) return;
+
+  auto before = OfflineBuildTarget::getModuleStats(this->llvmModule.get());
+
+  // Only the entry point, exported items and LLVM's own globals (the ctor and dtor arrays) keep their external
+  // linkage. Everything else becomes internal so that unused definitions can be dropped and the rest can be freely
+  // inlined and specialized by the optimizer.
+  llvm::legacy::PassManager pass;
+  pass.add(llvm::createInternalizePass([this](llvm::GlobalValue const &gv)->bool {
+    auto name = gv.getName();
+    return name == "main" || name.startswith("llvm.") || this->exportedSymbols.count(name) > 0;
+  }));
+  pass.add(llvm::createGlobalDCEPass());
+  pass.run(*this->llvmModule);
+
+  auto after = OfflineBuildTarget::getModuleStats(this->llvmModule.get());
+  outStream << S("Whole program: ") << after.externalCount << S(" of ") << before.externalCount
+    << S(" definitions kept external, removed ")
+    << (before.functionCount - after.functionCount) << S(" of ") << before.functionCount << S(" functions, ")
+    << (before.globalVarCount - after.globalVarCount) << S(" of ") << before.globalVarCount << S(" global vars and ")
+    << (before.instructionCount - after.instructionCount) << S(" of ") << before.instructionCount
+    << S(" instructions.\n");
+}
+
+
+void OfflineBuildTarget::optimizeModule()
+{
+  if (!this->isOptimizing() && this->profileGenerateFilename.empty() && this->profileUseFilename.empty()) return;
+
+  llvm::PassBuilder::OptimizationLevel level;
+  switch (this->optimizationLevel.val) {
+    case OptimizationLevel::O1: level = llvm::PassBuilder::OptimizationLevel::O1; break;
+    case OptimizationLevel::O2: level = llvm::PassBuilder::OptimizationLevel::O2; break;
+    case OptimizationLevel::O3: level = llvm::PassBuilder::OptimizationLevel::O3; break;
+    case OptimizationLevel::OS: level = llvm::PassBuilder::OptimizationLevel::Os; break;
+    case OptimizationLevel::OZ: level = llvm::PassBuilder::OptimizationLevel::Oz; break;
+    // The default pipeline can't be built for O0, and there is nothing to do anyway.
+    default: level = llvm::PassBuilder::OptimizationLevel::O0; break;
+  }
+
+  // Vectorization follows clang's defaults: enabled from O2 up and when optimizing for size, but not for minimum
+  // size.
+  llvm::PipelineTuningOptions tuningOptions;
+  tuningOptions.LoopVectorization = this->optimizationLevel >= OptimizationLevel::O2 &&
+    this->optimizationLevel != OptimizationLevel::OZ;
+  tuningOptions.SLPVectorization = tuningOptions.LoopVectorization;
+
+  llvm::PassBuilder passBuilder(this->targetMachine.get(), tuningOptions);
+  llvm::LoopAnalysisManager loopAnalysisManager;
+  llvm::FunctionAnalysisManager functionAnalysisManager;
+  llvm::CGSCCAnalysisManager cgsccAnalysisManager;
+  llvm::ModuleAnalysisManager moduleAnalysisManager;
+
+  // Library call info depends on the target, which isn't necessarily set on the module at this point.
+  llvm::Triple triple(this->targetTriple);
+  functionAnalysisManager.registerPass([&] {
+    return llvm::TargetLibraryAnalysis(llvm::TargetLibraryInfoImpl(triple));
+  });
+
+  passBuilder.registerModuleAnalyses(moduleAnalysisManager);
+  passBuilder.registerCGSCCAnalyses(cgsccAnalysisManager);
+  passBuilder.registerFunctionAnalyses(functionAnalysisManager);
+  passBuilder.registerLoopAnalyses(loopAnalysisManager);
+  passBuilder.crossRegisterProxies(
+    loopAnalysisManager, functionAnalysisManager, cgsccAnalysisManager, moduleAnalysisManager
+  );
+
+  // Profiles are taken from and applied to the unoptimized IR so that the generating and the using builds see the
+  // same control flow regardless of their optimization levels.
+  if (!this->profileGenerateFilename.empty()) {
+    llvm::ModulePassManager instrumentationPassManager;
+    instrumentationPassManager.addPass(llvm::PGOInstrumentationGen());
+    instrumentationPassManager.run(*this->llvmModule, moduleAnalysisManager);
+    this->lowerProfileInstrumentation();
+    // The module was modified outside of the pass managers.
+    moduleAnalysisManager.clear();
+    cgsccAnalysisManager.clear();
+    functionAnalysisManager.clear();
+    loopAnalysisManager.clear();
+  }
+  if (!this->profileUseFilename.empty()) {
+    auto indexedProfileFilename = this->generateIndexedProfile();
+    llvm::ModulePassManager profileUsePassManager;
+    profileUsePassManager.addPass(llvm::PGOInstrumentationUse(indexedProfileFilename));
+    profileUsePassManager.run(*this->llvmModule, moduleAnalysisManager);
+    llvm::sys::fs::remove(indexedProfileFilename);
+  }
+
+  if (level == llvm::PassBuilder::OptimizationLevel::O0) return;
+  auto modulePassManager = passBuilder.buildPerModuleDefaultPipeline(level);
+  modulePassManager.run(*this->llvmModule, moduleAnalysisManager);
+}
+
+
+void OfflineBuildTarget::lowerProfileInstrumentation()
+{
+  // The counters inserted by the instrumentation are lowered into a plain array per function, and the program
+  // writes them out itself when it exits, so the program doesn't need to be linked with LLVM's profile runtime.
+  // Value profiling depends on that runtime, so it is dropped.
+  auto &llvmContext = this->llvmModule->getContext();
+  auto int64Type = llvm::Type::getInt64Ty(llvmContext);
+  std::map<llvm::GlobalVariable*, llvm::GlobalVariable*> countersByName;
+  std::vector<std::pair<std::string, llvm::GlobalVariable*>> profiledFunctions;
+  std::vector<llvm::Instruction*> lowered;
+  for (auto &func : this->llvmModule->functions()) {
+    for (auto &inst : llvm::instructions(func)) {
+      if (llvm::isa<llvm::InstrProfValueProfileInst>(&inst)) {
+        lowered.push_back(&inst);
+        continue;
+      }
+      llvm::InstrProfIncrementInst *increment = llvm::dyn_cast<llvm::InstrProfIncrementInstStep>(&inst);
+      if (increment == 0) increment = llvm::dyn_cast<llvm::InstrProfIncrementInst>(&inst);
+      if (increment == 0) continue;
+
+      auto nameVar = increment->getName();
+      auto counterCount = increment->getNumCounters()->getZExtValue();
+      auto countersType = llvm::ArrayType::get(int64Type, counterCount);
+      auto &counters = countersByName[nameVar];
+      if (counters == 0) {
+        auto name = llvm::getPGOFuncNameVarInitializer(nameVar);
+        counters = new llvm::GlobalVariable(
+          *this->llvmModule, countersType, false, llvm::GlobalValue::PrivateLinkage,
+          llvm::ConstantAggregateZero::get(countersType), "__profc_" + name
+        );
+        // The record header in LLVM's text profile format, followed later by the counter values.
+        profiledFunctions.push_back(std::make_pair(
+          (name + "\n# Func Hash:\n" + llvm::Twine(increment->getHash()->getZExtValue()) +
+            "\n# Num Counters:\n" + llvm::Twine(counterCount) + "\n# Counter Values:\n").str(),
+          counters
+        ));
+      }
+
+      llvm::IRBuilder<> irBuilder(increment);
+      auto counter = irBuilder.CreateConstInBoundsGEP2_64(
+        countersType, counters, 0, increment->getIndex()->getZExtValue()
+      );
+      auto count = irBuilder.CreateLoad(int64Type, counter);
+      irBuilder.CreateStore(irBuilder.CreateAdd(count, increment->getStep()), counter);
+      lowered.push_back(increment);
+    }
+  }
+  for (auto inst : lowered) inst->eraseFromParent();
+  for (auto &entry : countersByName) {
+    if (entry.first->use_empty()) entry.first->eraseFromParent();
+  }
+
+  this->generateProfileWriter(profiledFunctions);
+}
+
+
+void OfflineBuildTarget::generateProfileWriter(
+  std::vector<std::pair<std::string, llvm::GlobalVariable*>> const &profiledFunctions
+) {
+  auto module = this->llvmModule.get();
+  auto &llvmContext = module->getContext();
+  auto voidType = llvm::Type::getVoidTy(llvmContext);
+  auto int32Type = llvm::Type::getInt32Ty(llvmContext);
+  auto int64Type = llvm::Type::getInt64Ty(llvmContext);
+  auto int8PtrType = llvm::Type::getInt8PtrTy(llvmContext);
+  auto int64PtrType = int64Type->getPointerTo();
+  // C's long, which is 32 bits on Windows regardless of the pointer size.
+  auto longType = llvm::Triple(this->targetTriple).isOSWindows() ?
+    int32Type : llvm::Type::getIntNTy(llvmContext, this->llvmDataLayout->getPointerSizeInBits());
+
+  auto createString = [&](llvm::StringRef str)->llvm::Constant* {
+    auto data = llvm::ConstantDataArray::getString(llvmContext, str);
+    auto var = new llvm::GlobalVariable(
+      *module, data->getType(), true, llvm::GlobalValue::PrivateLinkage, data, "__profstr"
+    );
+    return llvm::ConstantExpr::getPointerCast(var, int8PtrType);
+  };
+
+  // A table of the profiled functions, each with its record header, counters, and counter count.
+  auto recordType = llvm::StructType::get(llvmContext, { int8PtrType, int64PtrType, int64Type });
+  std::vector<llvm::Constant*> records;
+  for (auto &profiledFunction : profiledFunctions) {
+    auto counters = profiledFunction.second;
+    records.push_back(llvm::ConstantStruct::get(recordType, {
+      createString(profiledFunction.first),
+      llvm::ConstantExpr::getPointerCast(counters, int64PtrType),
+      llvm::ConstantInt::get(int64Type, counters->getValueType()->getArrayNumElements())
+    }));
+  }
+  auto recordsType = llvm::ArrayType::get(recordType, records.size());
+  auto recordsVar = new llvm::GlobalVariable(
+    *module, recordsType, true, llvm::GlobalValue::PrivateLinkage, llvm::ConstantArray::get(recordsType, records),
+    "__profrecords"
+  );
+
+  auto fopenFunc = module->getOrInsertFunction("fopen", int8PtrType, int8PtrType, int8PtrType);
+  auto fseekFunc = module->getOrInsertFunction("fseek", int32Type, int8PtrType, longType, int32Type);
+  auto ftellFunc = module->getOrInsertFunction("ftell", longType, int8PtrType);
+  auto fputsFunc = module->getOrInsertFunction("fputs", int32Type, int8PtrType, int8PtrType);
+  auto fprintfFunc = module->getOrInsertFunction(
+    "fprintf", llvm::FunctionType::get(int32Type, { int8PtrType, int8PtrType }, true)
+  );
+  auto fcloseFunc = module->getOrInsertFunction("fclose", int32Type, int8PtrType);
+
+  auto writerFunc = llvm::Function::Create(
+    llvm::FunctionType::get(voidType, false), llvm::GlobalValue::InternalLinkage, "__alusus_profile_write", module
+  );
+  auto entryBlock = llvm::BasicBlock::Create(llvmContext, "", writerFunc);
+  auto openedBlock = llvm::BasicBlock::Create(llvmContext, "opened", writerFunc);
+  auto headerBlock = llvm::BasicBlock::Create(llvmContext, "header", writerFunc);
+  auto recordsBlock = llvm::BasicBlock::Create(llvmContext, "records", writerFunc);
+  auto recordBlock = llvm::BasicBlock::Create(llvmContext, "record", writerFunc);
+  auto countersBlock = llvm::BasicBlock::Create(llvmContext, "counters", writerFunc);
+  auto counterBlock = llvm::BasicBlock::Create(llvmContext, "counter", writerFunc);
+  auto nextRecordBlock = llvm::BasicBlock::Create(llvmContext, "nextRecord", writerFunc);
+  auto closeBlock = llvm::BasicBlock::Create(llvmContext, "close", writerFunc);
+  auto exitBlock = llvm::BasicBlock::Create(llvmContext, "exit", writerFunc);
+  llvm::IRBuilder<> irBuilder(entryBlock);
+
+  // Profiles of multiple runs are appended to the same file, and get merged when the profile is used.
+  auto file = irBuilder.CreateCall(fopenFunc, {
+    createString(this->profileGenerateFilename), createString("a")
+  });
+  irBuilder.CreateCondBr(irBuilder.CreateIsNull(file), exitBlock, openedBlock);
+
+  // The text profile header is only written at the start of the file.
+  irBuilder.SetInsertPoint(openedBlock);
+  irBuilder.CreateCall(fseekFunc, { file, llvm::ConstantInt::get(longType, 0), llvm::ConstantInt::get(int32Type, 2) });
+  auto position = irBuilder.CreateCall(ftellFunc, { file });
+  irBuilder.CreateCondBr(irBuilder.CreateIsNull(position), headerBlock, recordsBlock);
+
+  irBuilder.SetInsertPoint(headerBlock);
+  irBuilder.CreateCall(fputsFunc, { createString(":ir\n"), file });
+  irBuilder.CreateBr(recordsBlock);
+
+  irBuilder.SetInsertPoint(recordsBlock);
+  auto recordIndex = irBuilder.CreatePHI(int64Type, 3);
+  recordIndex->addIncoming(llvm::ConstantInt::get(int64Type, 0), openedBlock);
+  recordIndex->addIncoming(llvm::ConstantInt::get(int64Type, 0), headerBlock);
+  irBuilder.CreateCondBr(
+    irBuilder.CreateICmpEQ(recordIndex, llvm::ConstantInt::get(int64Type, records.size())), closeBlock, recordBlock
+  );
+
+  irBuilder.SetInsertPoint(recordBlock);
+  auto zero = llvm::ConstantInt::get(int32Type, 0);
+  auto recordHeader = irBuilder.CreateLoad(
+    int8PtrType, irBuilder.CreateInBoundsGEP(recordsType, recordsVar, { zero, recordIndex, zero })
+  );
+  auto recordCounters = irBuilder.CreateLoad(
+    int64PtrType,
+    irBuilder.CreateInBoundsGEP(recordsType, recordsVar, { zero, recordIndex, llvm::ConstantInt::get(int32Type, 1) })
+  );
+  auto recordCounterCount = irBuilder.CreateLoad(
+    int64Type,
+    irBuilder.CreateInBoundsGEP(recordsType, recordsVar, { zero, recordIndex, llvm::ConstantInt::get(int32Type, 2) })
+  );
+  irBuilder.CreateCall(fputsFunc, { recordHeader, file });
+  irBuilder.CreateBr(countersBlock);
+
+  irBuilder.SetInsertPoint(countersBlock);
+  auto counterIndex = irBuilder.CreatePHI(int64Type, 2);
+  counterIndex->addIncoming(llvm::ConstantInt::get(int64Type, 0), recordBlock);
+  irBuilder.CreateCondBr(irBuilder.CreateICmpEQ(counterIndex, recordCounterCount), nextRecordBlock, counterBlock);
+
+  irBuilder.SetInsertPoint(counterBlock);
+  auto count = irBuilder.CreateLoad(int64Type, irBuilder.CreateInBoundsGEP(int64Type, recordCounters, counterIndex));
+  irBuilder.CreateCall(fprintfFunc, { file, createString("%llu\n"), count });
+  counterIndex->addIncoming(irBuilder.CreateAdd(counterIndex, llvm::ConstantInt::get(int64Type, 1)), counterBlock);
+  irBuilder.CreateBr(countersBlock);
+
+  irBuilder.SetInsertPoint(nextRecordBlock);
+  recordIndex->addIncoming(irBuilder.CreateAdd(recordIndex, llvm::ConstantInt::get(int64Type, 1)), nextRecordBlock);
+  irBuilder.CreateBr(recordsBlock);
+
+  irBuilder.SetInsertPoint(closeBlock);
+  irBuilder.CreateCall(fcloseFunc, { file });
+  irBuilder.CreateBr(exitBlock);
+
+  irBuilder.SetInsertPoint(exitBlock);
+  irBuilder.CreateRetVoid();
+
+  llvm::appendToGlobalDtors(*module, writerFunc, 0);
+}
+
+
+std::string OfflineBuildTarget::generateIndexedProfile() const
+{
+  // The optimizer only reads LLVM's indexed profile format, so the text profile, which could hold the records of
+  // multiple runs, is merged into a temporary indexed profile.
+  auto reader = llvm::InstrProfReader::create(this->profileUseFilename);
+  if (!reader) {
+    throw EXCEPTION(
+      FileException, this->profileUseFilename.c_str(), C('r'), llvm::toString(reader.takeError()).c_str()
+    );
+  }
+  llvm::InstrProfWriter writer;
+  llvm::cantFail(writer.setIsIRLevelProfile(true, false));
+  for (auto &record : **reader) {
+    writer.addRecord(std::move(record), 1, [](llvm::Error error) { llvm::consumeError(std::move(error)); });
+  }
+  if ((*reader)->hasError()) {
+    throw EXCEPTION(
+      FileException, this->profileUseFilename.c_str(), C('r'), llvm::toString((*reader)->getError()).c_str()
+    );
+  }
+
+  int fd;
+  llvm::SmallString<128> indexedFilename;
+  auto ec = llvm::sys::fs::createTemporaryFile("alusus", "profdata", fd, indexedFilename);
+  if (ec) {
+    throw EXCEPTION(FileException, indexedFilename.c_str(), C('w'), ec.message().c_str());
+  }
+  llvm::raw_fd_ostream stream(fd, true);
+  stream << writer.writeBuffer()->getBuffer();
+  return indexedFilename.str().str();
+}
+
+
+OfflineBuildTarget::ModuleStats OfflineBuildTarget::getModuleStats(llvm::Module *module)
+{
+  ModuleStats stats;
+  for (auto &func : module->functions()) {
+    if (func.isDeclaration()) continue;
+    ++stats.functionCount;
+    stats.instructionCount += func.getInstructionCount();
+    if (!func.hasLocalLinkage()) ++stats.externalCount;
+  }
+  for (auto &var : module->globals()) {
+    if (var.isDeclaration() || var.getName().startswith("llvm.")) continue;
+    ++stats.globalVarCount;
+    if (!var.hasLocalLinkage()) ++stats.externalCount;
+  }
+  return stats;
+}
+
+
+Str OfflineBuildTarget::getPartitionFilename(Char const *filename, Word index)
+{
+  if (index == 0) return Str(filename);
+
+  // Insert the partition index before the extension, if any, so that `output.o` becomes `output-1.o`.
+  Str name(filename);
+  auto dirEnd = name.findLast(C('/'));
+  auto extStart = name.findLast(C('.'));
+  if (extStart <= dirEnd) extStart = name.getLength();
+  return name.slice(0, extStart) + C('-') + (LongInt)index + (name.getBuf() + extStart);
 }
 
 
@@ -27,6 +27,8 @@ class OfflineBuildTarget : public BuildTarget
   //============================================================================
   // Types
 
+  public: s_enum(OptimizationLevel, O0, O1, O2, O3, OS, OZ);
+
   private: struct LlvmGlobalCtorDtorEntryTypes
   {
     llvm::PointerType *llvmFuncPtrType = 0;
@@ -34,17 +36,51 @@ class OfflineBuildTarget : public BuildTarget
     llvm::StructType *llvmStructType = 0;
   };
 
+  private: struct ModuleStats
+  {
+    Word functionCount = 0;
+    Word globalVarCount = 0;
+    Word instructionCount = 0;
+    Word externalCount = 0;
+  };
+
 
   //============================================================================
   // Member Variables
 
   private: std::string targetTriple;
+  private: llvm::Target const *llvmTarget = 0;
   private: std::unique_ptr<llvm::TargetMachine> targetMachine;
   private: std::unique_ptr<llvm::DataLayout> llvmDataLayout;
   private: std::unique_ptr<llvm::LLVMContext> llvmContext;
   private: std::unique_ptr<llvm::Module> llvmModule;
   private: LlvmGlobalCtorDtorEntryTypes llvmGlobalCtorDtorEntryTypes;
 
+  /// The number of threads used for generating object code. Values above 1 split the module into partitions.
+  private: Word codeGenThreadCount = 1;
+
+  /// The optimization pipeline to run on the module before generating IR or object code.
+  private: OptimizationLevel optimizationLevel = OptimizationLevel::O0;
+
+  /// The CPU to generate code for. `native` selects the host's CPU along with all its features.
+  private: std::string targetCpu = "generic";
+
+  /// Comma separated list of target features in LLVM's format, e.g. `+avx2,-sse4a`.
+  private: std::string targetFeatures;
+
+  /// Whether the module is treated as the whole program, internalizing everything other than the entry point and
+  /// the exported symbols, then dropping unused definitions.
+  private: Bool wholeProgram = false;
+
+  /// Symbols that keep their external linkage in whole program mode.
+  private: llvm::StringSet<> exportedSymbols;
+
+  /// The file to which the instrumented program appends its execution profile. Empty if not instrumenting.
+  private: std::string profileGenerateFilename;
+
+  /// The execution profile, as written by an instrumented program, used to guide optimization. Empty if not used.
+  private: std::string profileUseFilename;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -75,6 +111,72 @@ class OfflineBuildTarget : public BuildTarget
     return this->targetTriple;
   }
 
+  public: void setCodeGenThreadCount(Word count)
+  {
+    this->codeGenThreadCount = count;
+  }
+
+  public: Word getCodeGenThreadCount() const
+  {
+    return this->codeGenThreadCount;
+  }
+
+  public: void setOptimizationLevel(OptimizationLevel level)
+  {
+    this->optimizationLevel = level;
+  }
+
+  public: OptimizationLevel getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  public: void setTargetCpu(Char const *cpu);
+
+  public: std::string const& getTargetCpu() const
+  {
+    return this->targetCpu;
+  }
+
+  public: void setTargetFeatures(Char const *features);
+
+  public: std::string const& getTargetFeatures() const
+  {
+    return this->targetFeatures;
+  }
+
+  public: void setWholeProgram(Bool wp)
+  {
+    this->wholeProgram = wp;
+  }
+
+  public: Bool isWholeProgram() const
+  {
+    return this->wholeProgram;
+  }
+
+  public: void setProfileGenerateFilename(Char const *filename)
+  {
+    this->profileGenerateFilename = filename == 0 ? "" : filename;
+  }
+
+  public: std::string const& getProfileGenerateFilename() const
+  {
+    return this->profileGenerateFilename;
+  }
+
+  public: void setProfileUseFilename(Char const *filename)
+  {
+    this->profileUseFilename = filename == 0 ? "" : filename;
+  }
+
+  public: std::string const& getProfileUseFilename() const
+  {
+    return this->profileUseFilename;
+  }
+
+  public: void setCodeGenFlags(Array<Str> const *flags);
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -96,12 +198,42 @@ class OfflineBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  public: virtual Bool isOptimizing()
+  {
+    return this->optimizationLevel != OptimizationLevel::O0;
+  }
+
+  public: virtual void addExportedSymbol(llvm::StringRef name)
+  {
+    this->exportedSymbols.insert(name);
+  }
+
   public: Str generateLlvmIr(Array<Str> const *ctorNames, Array<Str> const *dtorNames);
 
   public: void generateObjectFile(
-    Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames
+    Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames, Array<Str> *objectFilenames = 0
+  );
+
+  private: std::unique_ptr<llvm::TargetMachine> createTargetMachine() const;
+
+  private: llvm::CodeGenOpt::Level getCodeGenOptLevel() const;
+
+  private: void internalizeModule();
+
+  private: void optimizeModule();
+
+  private: void lowerProfileInstrumentation();
+
+  private: void generateProfileWriter(
+    std::vector<std::pair<std::string, llvm::GlobalVariable*>> const &profiledFunctions
   );
 
+  private: std::string generateIndexedProfile() const;
+
+  private: static ModuleStats getModuleStats(llvm::Module *module);
+
+  private: static Str getPartitionFilename(Char const *filename, Word index);
+
   private: void buildCtorOrDtorArray(Array<Str> const *funcNames, Char const *globalVarName);
 
 }; // class
@@ -28,20 +28,32 @@ void TargetGenerator::initBindings()
   targetGeneration->generateFloatType = &TargetGenerator::generateFloatType;
   targetGeneration->generatePointerType = &TargetGenerator::generatePointerType;
   targetGeneration->generateArrayType = &TargetGenerator::generateArrayType;
+  targetGeneration->generateVectorType = &TargetGenerator::generateVectorType;
   targetGeneration->generateStructTypeDecl = &TargetGenerator::generateStructTypeDecl;
   targetGeneration->generateStructTypeBody = &TargetGenerator::generateStructTypeBody;
   targetGeneration->getTypeAllocationSize = &TargetGenerator::getTypeAllocationSize;
 
   // Function Generation Functions
   targetGeneration->generateFunctionType = &TargetGenerator::generateFunctionType;
+  targetGeneration->generateFunctionArgAttributes = &TargetGenerator::generateFunctionArgAttributes;
   targetGeneration->generateFunctionDecl = &TargetGenerator::generateFunctionDecl;
+  targetGeneration->generateIntrinsicFunctionDecl = &TargetGenerator::generateIntrinsicFunctionDecl;
+  targetGeneration->generateFunctionAttributes = &TargetGenerator::generateFunctionAttributes;
   targetGeneration->prepareFunctionBody = &TargetGenerator::prepareFunctionBody;
   targetGeneration->finishFunctionBody = &TargetGenerator::finishFunctionBody;
   targetGeneration->deleteFunction = &TargetGenerator::deleteFunction;
+  targetGeneration->exportFunction = &TargetGenerator::exportFunction;
 
   // Variable Definition Generation Functions
   targetGeneration->generateGlobalVariable = &TargetGenerator::generateGlobalVariable;
   targetGeneration->generateLocalVariable = &TargetGenerator::generateLocalVariable;
+  targetGeneration->generateVarLifetimeStart = &TargetGenerator::generateVarLifetimeStart;
+  targetGeneration->generateVarLifetimeEnd = &TargetGenerator::generateVarLifetimeEnd;
+
+  // Debug Info Generation Functions
+  targetGeneration->prepareFunctionDebugInfo = &TargetGenerator::prepareFunctionDebugInfo;
+  targetGeneration->setDebugLocation = &TargetGenerator::setDebugLocation;
+  targetGeneration->generateVarDebugInfo = &TargetGenerator::generateVarDebugInfo;
 
   // Statements Generation Functions
   targetGeneration->prepareIfStatement = &TargetGenerator::prepareIfStatement;
@@ -50,8 +62,13 @@ void TargetGenerator::initBindings()
   targetGeneration->finishWhileStatement = &TargetGenerator::finishWhileStatement;
   targetGeneration->prepareForStatement = &TargetGenerator::prepareForStatement;
   targetGeneration->finishForStatement = &TargetGenerator::finishForStatement;
+  targetGeneration->generateLoopHints = &TargetGenerator::generateLoopHints;
   targetGeneration->generateContinue = &TargetGenerator::generateContinue;
   targetGeneration->generateBreak = &TargetGenerator::generateBreak;
+  targetGeneration->prepareCleanupBlock = &TargetGenerator::prepareCleanupBlock;
+  targetGeneration->finishCleanupBlock = &TargetGenerator::finishCleanupBlock;
+  targetGeneration->addCleanupBlockExit = &TargetGenerator::addCleanupBlockExit;
+  targetGeneration->generateCleanupJump = &TargetGenerator::generateCleanupJump;
 
   // Casting Generation Functions
   targetGeneration->generateCastIntToInt = &TargetGenerator::generateCastIntToInt;
@@ -110,6 +127,16 @@ void TargetGenerator::initBindings()
   targetGeneration->generateLessThan = &TargetGenerator::generateLessThan;
   targetGeneration->generateLessThanOrEqual = &TargetGenerator::generateLessThanOrEqual;
 
+  // Vector Ops Generation Functions
+  targetGeneration->generateVectorSplat = &TargetGenerator::generateVectorSplat;
+  targetGeneration->generateVectorShuffle = &TargetGenerator::generateVectorShuffle;
+  targetGeneration->generateVectorReduction = &TargetGenerator::generateVectorReduction;
+  targetGeneration->generateAtomicLoad = &TargetGenerator::generateAtomicLoad;
+  targetGeneration->generateAtomicStore = &TargetGenerator::generateAtomicStore;
+  targetGeneration->generateAtomicRmw = &TargetGenerator::generateAtomicRmw;
+  targetGeneration->generateAtomicCmpXchg = &TargetGenerator::generateAtomicCmpXchg;
+  targetGeneration->generateFence = &TargetGenerator::generateFence;
+
   // Literal Generation Functions
   targetGeneration->generateIntLiteral = &TargetGenerator::generateIntLiteral;
   targetGeneration->generateFloatLiteral = &TargetGenerator::generateFloatLiteral;
@@ -117,6 +144,7 @@ void TargetGenerator::initBindings()
   targetGeneration->generateNullPtrLiteral = &TargetGenerator::generateNullPtrLiteral;
   targetGeneration->generateStructLiteral = &TargetGenerator::generateStructLiteral;
   targetGeneration->generateArrayLiteral = &TargetGenerator::generateArrayLiteral;
+  targetGeneration->generateVectorLiteral = &TargetGenerator::generateVectorLiteral;
   targetGeneration->generatePointerLiteral = &TargetGenerator::generatePointerLiteral;
 }
 
@@ -200,6 +228,15 @@ Bool TargetGenerator::generateArrayType(TiObject *contentType, Word size, TioSha
 }
 
 
+Bool TargetGenerator::generateVectorType(TiObject *elementType, Word size, TioSharedPtr &type)
+{
+  PREPARE_ARG(elementType, elementTypeWrapper, Type);
+  auto llvmType = llvm::VectorType::get(elementTypeWrapper->getLlvmType(), size, false);
+  type = newSrdObj<VectorType>(llvmType, getSharedPtr(elementTypeWrapper), size);
+  return true;
+}
+
+
 Bool TargetGenerator::generateStructTypeDecl(
   Char const *name, TioSharedPtr &type
 ) {
@@ -299,6 +336,21 @@ Bool TargetGenerator::generateFunctionType(
 }
 
 
+Bool TargetGenerator::generateFunctionArgAttributes(TiObject *functionType, Word argIndex, Word attributes)
+{
+  PREPARE_ARG(functionType, funcTypeWrapper, FunctionType);
+  auto derefAttributes =
+    CodeGen::FunctionArgAttribute::DEREFERENCEABLE | CodeGen::FunctionArgAttribute::DEREFERENCEABLE_OR_NULL;
+  if (
+    (attributes & derefAttributes) && !funcTypeWrapper->getArgs()->getElement(argIndex)->isDerivedFrom<PointerType>()
+  ) {
+    throw EXCEPTION(InvalidArgumentException, S("attributes"), S("Dereferenceability requires a pointer arg."));
+  }
+  funcTypeWrapper->setArgAttributes(argIndex, attributes);
+  return true;
+}
+
+
 Bool TargetGenerator::generateFunctionDecl(Char const *name, TiObject *functionType, TioSharedPtr &function)
 {
   VALIDATE_NOT_NULL(name, functionType);
@@ -313,11 +365,98 @@ Bool TargetGenerator::generateFunctionDecl(Char const *name, TiObject *functionT
       llvmFuncType, llvm::Function::ExternalLinkage, name, this->buildTarget->getGlobalLlvmModule()
     );
   }
-  function = newSrdObj<Function>(name, funcTypeWrapper, llvmFunc);
+  auto funcWrapper = newSrdObj<Function>(name, funcTypeWrapper, llvmFunc);
+  if (llvmFunc != 0) this->applyFunctionAttributes(llvmFunc, funcWrapper.get());
+  function = funcWrapper;
+  return true;
+}
+
+
+Bool TargetGenerator::generateIntrinsicFunctionDecl(
+  Char const *name, TiObject *functionType, TioSharedPtr &function
+) {
+  VALIDATE_NOT_NULL(name, functionType);
+
+  PREPARE_ARG(functionType, funcTypeWrapper, FunctionType);
+  auto llvmFuncType = funcTypeWrapper->getLlvmFunctionType();
+
+  // Find the intrinsic and make sure the given function type matches its signature.
+  auto id = llvm::Function::lookupIntrinsicID(name);
+  if (id == llvm::Intrinsic::not_intrinsic) return false;
+  llvm::SmallVector<llvm::Intrinsic::IITDescriptor, 8> table;
+  llvm::Intrinsic::getIntrinsicInfoTableEntries(id, table);
+  llvm::ArrayRef<llvm::Intrinsic::IITDescriptor> tableRef = table;
+  llvm::SmallVector<llvm::Type*, 4> overloadTypes;
+  if (
+    llvm::Intrinsic::matchIntrinsicSignature(llvmFuncType, tableRef, overloadTypes) !=
+    llvm::Intrinsic::MatchIntrinsicTypes_Match
+  ) {
+    return false;
+  }
+  if (llvm::Intrinsic::matchIntrinsicVarArg(llvmFuncType->isVarArg(), tableRef)) return false;
+
+  // Overloaded intrinsics are named after the types they are used with, so we'll use the full name from now on.
+  Str fullName = llvm::Intrinsic::isOverloaded(id) ?
+    llvm::Intrinsic::getName(id, overloadTypes).c_str() : name;
+
+  llvm::Function *llvmFunc = 0;
+  if (!this->perFunctionModules) {
+    llvmFunc = llvm::Intrinsic::getDeclaration(this->buildTarget->getGlobalLlvmModule(), id, overloadTypes);
+  }
+  function = newSrdObj<Function>(fullName.getBuf(), funcTypeWrapper, llvmFunc);
   return true;
 }
 
 
+Bool TargetGenerator::generateFunctionAttributes(TiObject *function, Word attributes)
+{
+  PREPARE_ARG(function, funcWrapper, Function);
+  funcWrapper->setAttributes(attributes);
+  // In per function modules mode the LLVM function is created later and gets its attributes then.
+  if (funcWrapper->getLlvmFunction() != 0) {
+    this->applyFunctionAttributes(funcWrapper->getLlvmFunction(), funcWrapper);
+  }
+  return true;
+}
+
+
+void TargetGenerator::applyFunctionAttributes(llvm::Function *llvmFunc, Function *funcWrapper)
+{
+  auto attributes = funcWrapper->getAttributes();
+  if (attributes & CodeGen::FunctionAttribute::ALWAYS_INLINE) llvmFunc->addFnAttr(llvm::Attribute::AlwaysInline);
+  if (attributes & CodeGen::FunctionAttribute::NO_INLINE) llvmFunc->addFnAttr(llvm::Attribute::NoInline);
+  if (attributes & CodeGen::FunctionAttribute::HOT) llvmFunc->addFnAttr(llvm::Attribute::Hot);
+  if (attributes & CodeGen::FunctionAttribute::COLD) llvmFunc->addFnAttr(llvm::Attribute::Cold);
+  if (attributes & CodeGen::FunctionAttribute::READ_ONLY) llvmFunc->addFnAttr(llvm::Attribute::ReadOnly);
+  if (attributes & CodeGen::FunctionAttribute::NO_UNWIND) llvmFunc->addFnAttr(llvm::Attribute::NoUnwind);
+  if (attributes & CodeGen::FunctionAttribute::WILL_RETURN) llvmFunc->addFnAttr(llvm::Attribute::WillReturn);
+
+  auto funcTypeWrapper = funcWrapper->getFunctionType();
+  auto argTypes = funcTypeWrapper->getArgs();
+  for (Int i = 0; i < argTypes->getElementCount(); ++i) {
+    auto argAttributes = funcTypeWrapper->getArgAttributes(i);
+    if (argAttributes == 0) continue;
+    if (argAttributes & CodeGen::FunctionArgAttribute::NO_ALIAS) llvmFunc->addParamAttr(i, llvm::Attribute::NoAlias);
+    if (argAttributes & CodeGen::FunctionArgAttribute::NON_NULL) llvmFunc->addParamAttr(i, llvm::Attribute::NonNull);
+    if (
+      argAttributes &
+      (CodeGen::FunctionArgAttribute::DEREFERENCEABLE | CodeGen::FunctionArgAttribute::DEREFERENCEABLE_OR_NULL)
+    ) {
+      // The content could still be an opaque struct at this point, in which case its size is unknown.
+      auto llvmContentType = static_cast<PointerType*>(argTypes->getElement(i))->getContentType()->getLlvmType();
+      if (!llvmContentType->isSized()) continue;
+      Word size = this->buildTarget->getLlvmDataLayout()->getTypeAllocSize(llvmContentType);
+      if (size == 0) continue;
+      if (argAttributes & CodeGen::FunctionArgAttribute::DEREFERENCEABLE) {
+        llvmFunc->addDereferenceableParamAttr(i, size);
+      } else {
+        llvmFunc->addDereferenceableOrNullParamAttr(i, size);
+      }
+    }
+  }
+}
+
+
 Bool TargetGenerator::prepareFunctionBody(
   TiObject *function, TiObject *functionType, SharedList<TiObject> *args, TioSharedPtr &context
 ) {
@@ -334,6 +473,7 @@ Bool TargetGenerator::prepareFunctionBody(
       funcWrapper->getFunctionType()->getLlvmFunctionType(), llvm::Function::ExternalLinkage,
       funcWrapper->getName().getBuf(), funcWrapper->llvmModule.get()
     );
+    this->applyFunctionAttributes(llvmFunc, funcWrapper);
     funcWrapper->setLlvmFunction(llvmFunc);
     llvmModule = funcWrapper->llvmModule.get();
   } else {
@@ -342,6 +482,8 @@ Bool TargetGenerator::prepareFunctionBody(
   }
 
   // Create the block
+  funcWrapper->llvmLastEntryAlloca = 0;
+  funcWrapper->llvmCleanupSelector = 0;
   auto block = newSrdObj<Block>();
   block->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), llvmFunc
@@ -361,7 +503,7 @@ Bool TargetGenerator::prepareFunctionBody(
   // Is this a variadic funciton?
   if (funcWrapper->getFunctionType()->isVariadic()) {
     // Declare va_list var.
-    funcWrapper->llvmVaList = block->getIrBuilder()->CreateAlloca(this->buildTarget->getVaListType(), 0, "__vaList");
+    funcWrapper->llvmVaList = this->createEntryAlloca(block.get(), this->buildTarget->getVaListType(), "__vaList");
     // Add declaration for llvm.va_start function.
     llvm::Function *llvmVaStartFunc = llvmModule->getFunction("llvm.va_start");
     if (llvmVaStartFunc == 0) {
@@ -399,6 +541,35 @@ Bool TargetGenerator::finishFunctionBody(
     if (!this->generateReturn(context, 0, 0)) return false;
   }
 
+  // Cleanup blocks that ended up with a single exit don't need to check the selector, and if none of them needs it
+  // then the selector itself can be dropped.
+  if (funcWrapper->llvmCleanupSelector != 0) {
+    std::vector<llvm::Instruction*> llvmSelectorUsers;
+    for (auto llvmUser : funcWrapper->llvmCleanupSelector->users()) {
+      llvmSelectorUsers.push_back(llvm::cast<llvm::Instruction>(llvmUser));
+    }
+    Bool selectorNeeded = false;
+    for (auto llvmUser : llvmSelectorUsers) {
+      if (!llvm::isa<llvm::LoadInst>(llvmUser)) continue;
+      auto llvmSwitch = llvm::cast<llvm::SwitchInst>(llvmUser->user_back());
+      if (llvmSwitch->getNumCases() == 0) {
+        llvm::BranchInst::Create(llvmSwitch->getDefaultDest(), llvmSwitch);
+        llvmSwitch->eraseFromParent();
+        llvmUser->eraseFromParent();
+      } else {
+        selectorNeeded = true;
+      }
+    }
+    if (!selectorNeeded) {
+      for (auto llvmUser : llvmSelectorUsers) {
+        if (llvm::isa<llvm::StoreInst>(llvmUser)) llvmUser->eraseFromParent();
+      }
+      if (funcWrapper->llvmLastEntryAlloca == funcWrapper->llvmCleanupSelector) funcWrapper->llvmLastEntryAlloca = 0;
+      funcWrapper->llvmCleanupSelector->eraseFromParent();
+    }
+    funcWrapper->llvmCleanupSelector = 0;
+  }
+
   if (this->perFunctionModules) {
     LOG(
       Spp::LogLevel::LLVMCODEGEN_IR, S("Adding function module to build target: ") << funcWrapper->getName()
@@ -418,6 +589,14 @@ Bool TargetGenerator::deleteFunction(TiObject *function)
 }
 
 
+Bool TargetGenerator::exportFunction(TiObject *function)
+{
+  PREPARE_ARG(function, funcWrapper, Function);
+  this->buildTarget->addExportedSymbol(funcWrapper->getName().getBuf());
+  return true;
+}
+
+
 //==============================================================================
 // Variable Definition Generation Functions
 
@@ -452,7 +631,7 @@ Bool TargetGenerator::generateLocalVariable(
   auto valWrapper = ti_cast<Value>(defaultValue);
 
   SharedPtr<Variable> var = newSrdObj<Variable>();
-  var->setLlvmAllocaInst(block->getIrBuilder()->CreateAlloca(typeWrapper->getLlvmType(), 0, name));
+  var->setLlvmAllocaInst(this->createEntryAlloca(block, typeWrapper->getLlvmType(), name));
   #if __APPLE__
     // TODO: This alignment should depend on build target rather than current OS.
     var->getLlvmAllocaInst()->setAlignment(llvm::MaybeAlign(16));
@@ -466,6 +645,138 @@ Bool TargetGenerator::generateLocalVariable(
 }
 
 
+Bool TargetGenerator::generateVarLifetimeStart(TiObject *context, TiObject *varDefinition)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(varDefinition, var, Variable);
+
+  // The marker covers the whole var. The size isn't specified since the var's type could still be an opaque struct
+  // at this point.
+  auto llvmAlloca = var->getLlvmAllocaInst();
+  if (llvmAlloca == 0 || !this->buildTarget->isOptimizing()) return true;
+  block->getIrBuilder()->CreateLifetimeStart(llvmAlloca);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVarLifetimeEnd(TiObject *context, TiObject *varDefinition)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(varDefinition, var, Variable);
+
+  auto llvmAlloca = var->getLlvmAllocaInst();
+  if (llvmAlloca == 0 || !this->buildTarget->isOptimizing()) return true;
+  block->getIrBuilder()->CreateLifetimeEnd(llvmAlloca);
+  return true;
+}
+
+
+//==============================================================================
+// Debug Info Generation Functions
+
+Bool TargetGenerator::prepareFunctionDebugInfo(
+  TiObject *function, TiObject *functionType, TiObject *context, Core::Data::SourceLocation *sourceLocation
+) {
+  PREPARE_ARG(function, funcWrapper, Function);
+  PREPARE_ARG(functionType, funcTypeWrapper, FunctionType);
+  PREPARE_ARG(context, block, Block);
+
+  // Per function modules aren't part of the global module, so they get no debug info.
+  auto debugInfoLevel = this->buildTarget->getDebugInfoLevel();
+  if (debugInfoLevel == BuildTarget::DebugInfoLevel::NONE || this->perFunctionModules) return true;
+  auto record = TargetGenerator::getSourceLocationRecord(sourceLocation);
+  if (record == 0) return true;
+
+  auto diBuilder = this->buildTarget->getDiBuilder();
+  auto diFile = this->buildTarget->getDiFile(record->filename.getBuf());
+
+  // Line tables don't need the types; the first element of the type array is the return type.
+  llvm::SmallVector<llvm::Metadata*, 8> diSignature;
+  if (debugInfoLevel == BuildTarget::DebugInfoLevel::FULL) {
+    diSignature.push_back(this->buildTarget->getDiType(funcTypeWrapper->getRetType().get()));
+    auto args = funcTypeWrapper->getArgs().get();
+    for (Int i = 0; args != 0 && i < args->getCount(); ++i) {
+      diSignature.push_back(this->buildTarget->getDiType(args->get(i).get()));
+    }
+  }
+
+  auto spFlags = llvm::DISubprogram::SPFlagDefinition;
+  if (this->buildTarget->isOptimizing()) spFlags |= llvm::DISubprogram::SPFlagOptimized;
+  auto llvmFunc = funcWrapper->getLlvmFunction();
+  auto diSubprogram = diBuilder->createFunction(
+    diFile, funcWrapper->getName().getBuf(), llvmFunc->getName(), diFile, record->line,
+    diBuilder->createSubroutineType(diBuilder->getOrCreateTypeArray(diSignature)), record->line,
+    llvm::DINode::FlagPrototyped, spFlags
+  );
+  llvmFunc->setSubprogram(diSubprogram);
+
+  block->getIrBuilder()->SetCurrentDebugLocation(
+    llvm::DILocation::get(*this->buildTarget->getLlvmContext(), record->line, record->column, diSubprogram)
+  );
+  return true;
+}
+
+
+Bool TargetGenerator::setDebugLocation(TiObject *context, Core::Data::SourceLocation *sourceLocation)
+{
+  PREPARE_ARG(context, block, Block);
+
+  auto llvmFunc = block->getFunction() == 0 ? 0 : block->getFunction()->getLlvmFunction();
+  auto diSubprogram = llvmFunc == 0 ? 0 : llvmFunc->getSubprogram();
+  if (diSubprogram == 0) return true;
+  auto record = TargetGenerator::getSourceLocationRecord(sourceLocation);
+  if (record == 0) return true;
+
+  block->getIrBuilder()->SetCurrentDebugLocation(llvm::DILocation::get(
+    *this->buildTarget->getLlvmContext(), record->line, record->column, this->getDebugScope(diSubprogram, record)
+  ));
+  return true;
+}
+
+
+Bool TargetGenerator::generateVarDebugInfo(
+  TiObject *context, TiObject *varDefinition, TiObject *type, Char const *name, Word argNumber,
+  Core::Data::SourceLocation *sourceLocation
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(varDefinition, var, Variable);
+  PREPARE_ARG(type, typeWrapper, Type);
+
+  if (this->buildTarget->getDebugInfoLevel() != BuildTarget::DebugInfoLevel::FULL) return true;
+  auto llvmFunc = block->getFunction() == 0 ? 0 : block->getFunction()->getLlvmFunction();
+  auto diSubprogram = llvmFunc == 0 ? 0 : llvmFunc->getSubprogram();
+  if (diSubprogram == 0 || var->getLlvmAllocaInst() == 0) return true;
+  auto record = TargetGenerator::getSourceLocationRecord(sourceLocation);
+  if (record == 0) return true;
+
+  auto diBuilder = this->buildTarget->getDiBuilder();
+  auto diFile = this->buildTarget->getDiFile(record->filename.getBuf());
+  auto diType = this->buildTarget->getDiType(typeWrapper);
+  llvm::DILocalVariable *diVar;
+  if (argNumber > 0) {
+    diVar = diBuilder->createParameterVariable(diSubprogram, name, argNumber, diFile, record->line, diType, true);
+  } else {
+    diVar = diBuilder->createAutoVariable(diSubprogram, name, diFile, record->line, diType, true);
+  }
+  diBuilder->insertDeclare(
+    var->getLlvmAllocaInst(), diVar, diBuilder->createExpression(),
+    llvm::DILocation::get(*this->buildTarget->getLlvmContext(), record->line, record->column, diSubprogram),
+    block->getIrBuilder()->GetInsertBlock()
+  );
+  return true;
+}
+
+
+llvm::DIScope* TargetGenerator::getDebugScope(
+  llvm::DISubprogram *diSubprogram, Core::Data::SourceLocationRecord *record
+) {
+  // Code coming from another file, through macros for example, is wrapped in a scope of that file.
+  auto diFile = this->buildTarget->getDiFile(record->filename.getBuf());
+  if (diFile == diSubprogram->getFile()) return diSubprogram;
+  return this->buildTarget->getDiBuilder()->createLexicalBlockFile(diSubprogram, diFile);
+}
+
+
 //==============================================================================
 // Statements Generation Functions
 
@@ -485,7 +796,7 @@ Bool TargetGenerator::prepareIfStatement(TiObject *context, Bool withElse, Share
       *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
     )
   );
-  bodyBlock->setIrBuilder(new llvm::IRBuilder<>(bodyBlock->getLlvmBlock()));
+  bodyBlock->setIrBuilder(this->createIrBuilder(block, bodyBlock->getLlvmBlock()));
   bodyBlock->setFunction(block->getFunction());
   ifContext->setBodyBlock(bodyBlock);
 
@@ -495,7 +806,7 @@ Bool TargetGenerator::prepareIfStatement(TiObject *context, Bool withElse, Share
     elseBlock->setLlvmBlock(llvm::BasicBlock::Create(
       *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
     ));
-    elseBlock->setIrBuilder(new llvm::IRBuilder<>(elseBlock->getLlvmBlock()));
+    elseBlock->setIrBuilder(this->createIrBuilder(block, elseBlock->getLlvmBlock()));
     elseBlock->setFunction(block->getFunction());
     ifContext->setElseBlock(elseBlock);
   }
@@ -559,7 +870,7 @@ Bool TargetGenerator::prepareWhileStatement(TiObject *context, SharedPtr<CodeGen
   condBlock->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  condBlock->setIrBuilder(new llvm::IRBuilder<>(condBlock->getLlvmBlock()));
+  condBlock->setIrBuilder(this->createIrBuilder(block, condBlock->getLlvmBlock()));
   condBlock->setFunction(block->getFunction());
   loopContext->setConditionBlock(condBlock);
 
@@ -568,7 +879,7 @@ Bool TargetGenerator::prepareWhileStatement(TiObject *context, SharedPtr<CodeGen
   bodyBlock->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  bodyBlock->setIrBuilder(new llvm::IRBuilder<>(bodyBlock->getLlvmBlock()));
+  bodyBlock->setIrBuilder(this->createIrBuilder(block, bodyBlock->getLlvmBlock()));
   bodyBlock->setFunction(block->getFunction());
   loopContext->setBodyBlock(bodyBlock);
 
@@ -593,7 +904,7 @@ Bool TargetGenerator::finishWhileStatement(
   PREPARE_ARG(conditionVal, valWrapper, Value);
 
   // Jump to condition block.
-  block->getIrBuilder()->CreateBr(loopContext->getConditionBlock()->getLlvmEntryBlock());
+  auto llvmEntryBranch = block->getIrBuilder()->CreateBr(loopContext->getConditionBlock()->getLlvmEntryBlock());
 
   // Jump from body to condition block.
   if (!loopContext->getBodyBlock()->isTerminated()) {
@@ -606,6 +917,8 @@ Bool TargetGenerator::finishWhileStatement(
     loopContext->getExitBlock()->getLlvmEntryBlock()
   );
 
+  this->applyLoopHints(loopContext, llvmEntryBranch);
+
   // Set insert point.
   block->getIrBuilder()->SetInsertPoint(loopContext->getExitBlock()->getLlvmBlock());
   block->setLlvmBlock(loopContext->getExitBlock()->getLlvmBlock());
@@ -625,7 +938,7 @@ Bool TargetGenerator::prepareForStatement(TiObject *context, SharedPtr<CodeGen::
   condBlock->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  condBlock->setIrBuilder(new llvm::IRBuilder<>(condBlock->getLlvmBlock()));
+  condBlock->setIrBuilder(this->createIrBuilder(block, condBlock->getLlvmBlock()));
   condBlock->setFunction(block->getFunction());
   loopContext->setConditionBlock(condBlock);
 
@@ -634,7 +947,7 @@ Bool TargetGenerator::prepareForStatement(TiObject *context, SharedPtr<CodeGen::
   updaterBlock->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  updaterBlock->setIrBuilder(new llvm::IRBuilder<>(updaterBlock->getLlvmBlock()));
+  updaterBlock->setIrBuilder(this->createIrBuilder(block, updaterBlock->getLlvmBlock()));
   updaterBlock->setFunction(block->getFunction());
   loopContext->setUpdaterBlock(updaterBlock);
 
@@ -643,7 +956,7 @@ Bool TargetGenerator::prepareForStatement(TiObject *context, SharedPtr<CodeGen::
   bodyBlock->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  bodyBlock->setIrBuilder(new llvm::IRBuilder<>(bodyBlock->getLlvmBlock()));
+  bodyBlock->setIrBuilder(this->createIrBuilder(block, bodyBlock->getLlvmBlock()));
   bodyBlock->setFunction(block->getFunction());
   loopContext->setBodyBlock(bodyBlock);
 
@@ -668,7 +981,7 @@ Bool TargetGenerator::finishForStatement(
   PREPARE_ARG(conditionVal, valWrapper, Value);
 
   // Jump to condition block.
-  block->getIrBuilder()->CreateBr(loopContext->getConditionBlock()->getLlvmEntryBlock());
+  auto llvmEntryBranch = block->getIrBuilder()->CreateBr(loopContext->getConditionBlock()->getLlvmEntryBlock());
 
   // Jump from body to update block.
   if (!loopContext->getBodyBlock()->isTerminated()) {
@@ -684,6 +997,8 @@ Bool TargetGenerator::finishForStatement(
     loopContext->getExitBlock()->getLlvmEntryBlock()
   );
 
+  this->applyLoopHints(loopContext, llvmEntryBranch);
+
   // Set insert point.
   block->getIrBuilder()->SetInsertPoint(loopContext->getExitBlock()->getLlvmBlock());
   block->setLlvmBlock(loopContext->getExitBlock()->getLlvmBlock());
@@ -692,6 +1007,103 @@ Bool TargetGenerator::finishForStatement(
 }
 
 
+Bool TargetGenerator::generateLoopHints(
+  CodeGen::LoopTgContext *loopTgContext, Word hints, Word unrollCount, Word vectorizeWidth
+) {
+  PREPARE_ARG(loopTgContext, loopContext, LoopContext);
+  loopContext->setHints(hints, unrollCount, vectorizeWidth);
+  return true;
+}
+
+
+void TargetGenerator::applyLoopHints(LoopContext *loopContext, llvm::Instruction *llvmEntryBranch)
+{
+  auto hints = loopContext->getHints();
+  if (hints == 0) return;
+
+  auto &llvmContext = *this->buildTarget->getLlvmContext();
+  auto llvmHeader = loopContext->getConditionBlock()->getLlvmEntryBlock();
+  auto llvmExit = loopContext->getExitBlock()->getLlvmEntryBlock();
+
+  // The latches are all the branches back into the condition other than the one entering the loop. This includes
+  // continue statements.
+  llvm::SmallPtrSet<llvm::BasicBlock*, 4> llvmLatchBlocks;
+  for (auto llvmPred : llvm::predecessors(llvmHeader)) {
+    if (llvmPred->getTerminator() != llvmEntryBranch) llvmLatchBlocks.insert(llvmPred);
+  }
+  if (llvmLatchBlocks.empty()) return;
+
+  auto makeProperty = [&llvmContext](Char const *name, llvm::Metadata *value)->llvm::MDNode* {
+    llvm::SmallVector<llvm::Metadata*, 2> llvmOps = { llvm::MDString::get(llvmContext, name) };
+    if (value != 0) llvmOps.push_back(value);
+    return llvm::MDNode::get(llvmContext, llvmOps);
+  };
+  auto makeInt = [&llvmContext](Word bitCount, Word value)->llvm::Metadata* {
+    return llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(llvm::Type::getIntNTy(llvmContext, bitCount), value));
+  };
+
+  // The first operand is a reference to the loop ID itself, which is set after the node is created.
+  llvm::SmallVector<llvm::Metadata*, 4> llvmProperties = { 0 };
+  if (hints & CodeGen::LoopHint::UNROLL) {
+    if (loopContext->getUnrollCount() > 0) {
+      llvmProperties.push_back(makeProperty("llvm.loop.unroll.count", makeInt(32, loopContext->getUnrollCount())));
+    } else {
+      llvmProperties.push_back(makeProperty("llvm.loop.unroll.enable", 0));
+    }
+  } else if (hints & CodeGen::LoopHint::NO_UNROLL) {
+    llvmProperties.push_back(makeProperty("llvm.loop.unroll.disable", 0));
+  }
+  if (hints & CodeGen::LoopHint::VECTORIZE) {
+    llvmProperties.push_back(makeProperty("llvm.loop.vectorize.enable", makeInt(1, 1)));
+    if (loopContext->getVectorizeWidth() > 0) {
+      llvmProperties.push_back(makeProperty("llvm.loop.vectorize.width", makeInt(32, loopContext->getVectorizeWidth())));
+    }
+  } else if (hints & CodeGen::LoopHint::NO_VECTORIZE) {
+    llvmProperties.push_back(makeProperty("llvm.loop.vectorize.enable", makeInt(1, 0)));
+  }
+  if (hints & CodeGen::LoopHint::PARALLEL_SAFE) {
+    // Find the loop's blocks, which are the blocks that are reachable from the condition without leaving the loop
+    // and that can reach back to the condition.
+    llvm::SmallPtrSet<llvm::BasicBlock*, 16> llvmReachableBlocks;
+    llvm::SmallVector<llvm::BasicBlock*, 16> llvmWorkList = { llvmHeader };
+    while (!llvmWorkList.empty()) {
+      auto llvmBlock = llvmWorkList.pop_back_val();
+      if (llvmBlock == llvmExit || !llvmReachableBlocks.insert(llvmBlock).second) continue;
+      for (auto llvmSucc : llvm::successors(llvmBlock)) llvmWorkList.push_back(llvmSucc);
+    }
+    llvm::SmallPtrSet<llvm::BasicBlock*, 16> llvmLoopBlocks;
+    llvmLoopBlocks.insert(llvmHeader);
+    llvmWorkList.append(llvmLatchBlocks.begin(), llvmLatchBlocks.end());
+    while (!llvmWorkList.empty()) {
+      auto llvmBlock = llvmWorkList.pop_back_val();
+      if (llvmReachableBlocks.count(llvmBlock) == 0 || !llvmLoopBlocks.insert(llvmBlock).second) continue;
+      for (auto llvmPred : llvm::predecessors(llvmBlock)) llvmWorkList.push_back(llvmPred);
+    }
+
+    // Put all memory accesses of the loop in one access group. Accesses of inner loops are already in the groups of
+    // those loops, so the groups are united.
+    auto llvmAccessGroup = llvm::MDNode::getDistinct(llvmContext, {});
+    for (auto llvmBlock : llvmLoopBlocks) {
+      for (auto &llvmInst : *llvmBlock) {
+        if (!llvmInst.mayReadOrWriteMemory()) continue;
+        auto llvmGroups = llvmInst.getMetadata(llvm::LLVMContext::MD_access_group);
+        llvmInst.setMetadata(
+          llvm::LLVMContext::MD_access_group,
+          llvmGroups == 0 ? llvmAccessGroup : llvm::uniteAccessGroups(llvmGroups, llvmAccessGroup)
+        );
+      }
+    }
+    llvmProperties.push_back(makeProperty("llvm.loop.parallel_accesses", llvmAccessGroup));
+  }
+
+  auto llvmLoopId = llvm::MDNode::getDistinct(llvmContext, llvmProperties);
+  llvmLoopId->replaceOperandWith(0, llvmLoopId);
+  for (auto llvmLatchBlock : llvmLatchBlocks) {
+    llvmLatchBlock->getTerminator()->setMetadata(llvm::LLVMContext::MD_loop, llvmLoopId);
+  }
+}
+
+
 Bool TargetGenerator::generateContinue(TiObject *context, CodeGen::LoopTgContext *loopTgContext)
 {
   PREPARE_ARG(context, block, Block);
@@ -718,6 +1130,64 @@ Bool TargetGenerator::generateBreak(TiObject *context, CodeGen::LoopTgContext *l
 }
 
 
+Bool TargetGenerator::prepareCleanupBlock(TiObject *context, TioSharedPtr &cleanupContext)
+{
+  PREPARE_ARG(context, block, Block);
+
+  auto cleanupBlock = newSrdObj<Block>();
+  cleanupBlock->setLlvmBlock(llvm::BasicBlock::Create(
+    *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
+  ));
+  cleanupBlock->setIrBuilder(this->createIrBuilder(block, cleanupBlock->getLlvmBlock()));
+  cleanupBlock->setFunction(block->getFunction());
+  cleanupContext = cleanupBlock;
+
+  return true;
+}
+
+
+Bool TargetGenerator::finishCleanupBlock(TiObject *cleanupContext, TiObject *exitContext)
+{
+  PREPARE_ARG(cleanupContext, cleanupBlock, Block);
+  PREPARE_ARG(exitContext, exitBlock, Block);
+
+  // Cleanup blocks are shared by all jumps into them, so the block to continue to is decided by the selector that
+  // was stored by the jump.
+  auto irBuilder = cleanupBlock->getIrBuilder();
+  auto llvmSelector = irBuilder->CreateLoad(this->getCleanupSelector(cleanupBlock));
+  cleanupBlock->llvmExitSwitch = irBuilder->CreateSwitch(llvmSelector, exitBlock->getLlvmEntryBlock());
+  cleanupBlock->setTerminated(true);
+  return true;
+}
+
+
+Bool TargetGenerator::addCleanupBlockExit(TiObject *cleanupContext, Word selector, TiObject *targetContext)
+{
+  PREPARE_ARG(cleanupContext, cleanupBlock, Block);
+  PREPARE_ARG(targetContext, targetBlock, Block);
+
+  auto llvmSwitch = cleanupBlock->llvmExitSwitch;
+  auto llvmSelectorType = llvm::cast<llvm::IntegerType>(llvmSwitch->getCondition()->getType());
+  llvmSwitch->addCase(llvm::ConstantInt::get(llvmSelectorType, selector), targetBlock->getLlvmEntryBlock());
+  return true;
+}
+
+
+Bool TargetGenerator::generateCleanupJump(TiObject *context, TiObject *cleanupContext, Word selector)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(cleanupContext, cleanupBlock, Block);
+
+  auto llvmSelector = this->getCleanupSelector(block);
+  block->getIrBuilder()->CreateStore(
+    llvm::ConstantInt::get(llvmSelector->getAllocatedType(), selector), llvmSelector
+  );
+  block->getIrBuilder()->CreateBr(cleanupBlock->getLlvmEntryBlock());
+  block->setTerminated(true);
+  return true;
+}
+
+
 //==============================================================================
 // Casting Generation Functions
 
@@ -879,7 +1349,7 @@ Bool TargetGenerator::generateMemberVarReference(
   if (tgStructType->isDerivedFrom<PointerType>()) {
     llvmPtr = tgStructRef->getLlvmValue();
   } else {
-    llvmPtr = block->getIrBuilder()->CreateAlloca(tgStructType->getLlvmType(), 0, "");
+    llvmPtr = this->createEntryAlloca(block, tgStructType->getLlvmType(), "");
     block->getIrBuilder()->CreateStore(tgStructRef->getLlvmValue(), llvmPtr);
   }
 
@@ -908,7 +1378,7 @@ Bool TargetGenerator::generateArrayElementReference(
   if (tgArrayType->isDerivedFrom<PointerType>()) {
     llvmPtr = tgArrayRef->getLlvmValue();
   } else {
-    llvmPtr = block->getIrBuilder()->CreateAlloca(tgArrayType->getLlvmType(), 0, "");
+    llvmPtr = this->createEntryAlloca(block, tgArrayType->getLlvmType(), "");
     block->getIrBuilder()->CreateStore(tgArrayRef->getLlvmValue(), llvmPtr);
   }
 
@@ -961,6 +1431,7 @@ Bool TargetGenerator::generateFunctionPointer(
       funcWrapper->getFunctionType()->getLlvmFunctionType(), llvm::Function::ExternalLinkage,
       funcWrapper->getName().getBuf(), llvmMod
     );
+    this->applyFunctionAttributes(llvmFunc, funcWrapper);
   }
 
   // Generate the func pointer.
@@ -995,7 +1466,7 @@ Bool TargetGenerator::generateFunctionCall(
 
     if (variadic && i >= argDefCount && llvmValue->getType()->isStructTy()) {
       // Convert struct types to pointers.
-      llvmValue = block->getIrBuilder()->CreateAlloca(llvmValue->getType(), 0, "");
+      llvmValue = this->createEntryAlloca(block, llvmValue->getType(), "");
       block->getIrBuilder()->CreateStore(llvmValBox->getLlvmValue(), llvmValue);
     }
 
@@ -1011,6 +1482,7 @@ Bool TargetGenerator::generateFunctionCall(
       funcWrapper->getFunctionType()->getLlvmFunctionType(), llvm::Function::ExternalLinkage,
       funcWrapper->getName().getBuf(), llvmMod
     );
+    this->applyFunctionAttributes(llvmFunc, funcWrapper);
   }
   // Create the call.
   auto llvmCall = block->getIrBuilder()->CreateCall(llvmFunc, args);
@@ -1048,7 +1520,7 @@ Bool TargetGenerator::generateFunctionPtrCall(
 
     if (variadic && i >= argDefCount && llvmValue->getType()->isStructTy()) {
       // Convert struct types to pointers.
-      llvmValue = block->getIrBuilder()->CreateAlloca(llvmValue->getType(), 0, "");
+      llvmValue = this->createEntryAlloca(block, llvmValue->getType(), "");
       block->getIrBuilder()->CreateStore(llvmValBox->getLlvmValue(), llvmValue);
     }
 
@@ -1107,7 +1579,7 @@ Bool TargetGenerator::prepareLogicalOp(TiObject *context, TioSharedPtr &secondCo
   block2->setLlvmBlock(llvm::BasicBlock::Create(
     *this->buildTarget->getLlvmContext(), this->getNewBlockName(), block->getFunction()->getLlvmFunction()
   ));
-  block2->setIrBuilder(new llvm::IRBuilder<>(block2->getLlvmBlock()));
+  block2->setIrBuilder(this->createIrBuilder(block, block2->getLlvmBlock()));
   block2->setFunction(block->getFunction());
   secondContext = block2;
 
@@ -1190,6 +1662,7 @@ Bool TargetGenerator::generateAdd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1223,6 +1696,7 @@ Bool TargetGenerator::generateSub(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1257,6 +1731,7 @@ Bool TargetGenerator::generateMul(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1283,6 +1758,7 @@ Bool TargetGenerator::generateDiv(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1309,6 +1785,7 @@ Bool TargetGenerator::generateRem(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
 
   if (tgType->isDerivedFrom<IntegerType>()) {
@@ -1336,6 +1813,7 @@ Bool TargetGenerator::generateShr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   llvm::Value *llvmResult;
@@ -1355,6 +1833,7 @@ Bool TargetGenerator::generateShl(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateShl(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
@@ -1369,6 +1848,7 @@ Bool TargetGenerator::generateAnd(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateAnd(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
@@ -1383,6 +1863,7 @@ Bool TargetGenerator::generateOr(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateOr(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
@@ -1397,6 +1878,7 @@ Bool TargetGenerator::generateXor(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcVal1Box, Value);
   PREPARE_ARG(srcVal2, srcVal2Box, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateXor(srcVal1Box->getLlvmValue(), srcVal2Box->getLlvmValue());
@@ -1410,6 +1892,7 @@ Bool TargetGenerator::generateNot(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, IntegerType);
 
   auto llvmResult = block->getIrBuilder()->CreateNot(srcValBox->getLlvmValue());
@@ -1423,6 +1906,7 @@ Bool TargetGenerator::generateNeg(
 ) {
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal, srcValBox, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateNeg(srcValBox->getLlvmValue());
@@ -1711,6 +2195,7 @@ Bool TargetGenerator::generateEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpEQ(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
@@ -1732,6 +2217,7 @@ Bool TargetGenerator::generateNotEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>() || tgType->isDerivedFrom<PointerType>()) {
     auto llvmResult = block->getIrBuilder()->CreateICmpNE(srcValBox1->getLlvmValue(), srcValBox2->getLlvmValue());
@@ -1753,6 +2239,7 @@ Bool TargetGenerator::generateGreaterThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1779,6 +2266,7 @@ Bool TargetGenerator::generateGreaterThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1805,6 +2293,7 @@ Bool TargetGenerator::generateLessThan(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1831,6 +2320,7 @@ Bool TargetGenerator::generateLessThanOrEqual(
   PREPARE_ARG(context, block, Block);
   PREPARE_ARG(srcVal1, srcValBox1, Value);
   PREPARE_ARG(srcVal2, srcValBox2, Value);
+  type = this->getScalarType(type);
   PREPARE_ARG(type, tgType, Type);
   if (tgType->isDerivedFrom<IntegerType>()) {
     llvm::Value *llvmResult;
@@ -1851,6 +2341,208 @@ Bool TargetGenerator::generateLessThanOrEqual(
 }
 
 
+//==============================================================================
+// Vector Ops Generation Functions
+
+Bool TargetGenerator::generateVectorSplat(
+  TiObject *context, TiObject *vectorType, TiObject *srcVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(vectorType, tgVectorType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  auto llvmResult = block->getIrBuilder()->CreateVectorSplat(tgVectorType->getSize(), srcValBox->getLlvmValue());
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorShuffle(
+  TiObject *context, TiObject *srcVal1, TiObject *srcVal2, Containing<TiObject> *indices, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(srcVal1, srcValBox1, Value);
+  VALIDATE_NOT_NULL(indices);
+  auto llvmVal1 = srcValBox1->getLlvmValue();
+  llvm::Value *llvmVal2;
+  if (srcVal2 != 0) {
+    PREPARE_ARG(srcVal2, srcValBox2, Value);
+    llvmVal2 = srcValBox2->getLlvmValue();
+  } else {
+    llvmVal2 = llvm::UndefValue::get(llvmVal1->getType());
+  }
+  std::vector<llvm::Constant*> llvmIndices;
+  for (Int i = 0; i < indices->getElementCount(); ++i) {
+    auto index = ti_cast<TiInt>(indices->getElement(i));
+    if (index == 0) {
+      throw EXCEPTION(GenericException, S("Unexpected shuffle index received."));
+    }
+    llvmIndices.push_back(llvm::ConstantInt::get(
+      *this->buildTarget->getLlvmContext(), llvm::APInt(32, index->get(), true)
+    ));
+  }
+  auto llvmResult = block->getIrBuilder()->CreateShuffleVector(
+    llvmVal1, llvmVal2, llvm::ConstantVector::get(llvmIndices)
+  );
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateVectorReduction(
+  TiObject *context, TiObject *vectorType, CodeGen::VectorReduction op, TiObject *srcVal, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(vectorType, tgVectorType, VectorType);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  auto irBuilder = block->getIrBuilder();
+  auto llvmSrc = srcValBox->getLlvmValue();
+  auto tgElementType = tgVectorType->getElementType().get();
+  llvm::Value *llvmResult;
+  if (tgElementType->isDerivedFrom<IntegerType>()) {
+    auto isSigned = static_cast<IntegerType*>(tgElementType)->isSigned();
+    switch (op.get()) {
+      case CodeGen::VectorReduction::ADD: llvmResult = irBuilder->CreateAddReduce(llvmSrc); break;
+      case CodeGen::VectorReduction::MUL: llvmResult = irBuilder->CreateMulReduce(llvmSrc); break;
+      case CodeGen::VectorReduction::MIN: llvmResult = irBuilder->CreateIntMinReduce(llvmSrc, isSigned); break;
+      case CodeGen::VectorReduction::MAX: llvmResult = irBuilder->CreateIntMaxReduce(llvmSrc, isSigned); break;
+      case CodeGen::VectorReduction::AND: llvmResult = irBuilder->CreateAndReduce(llvmSrc); break;
+      case CodeGen::VectorReduction::OR: llvmResult = irBuilder->CreateOrReduce(llvmSrc); break;
+      case CodeGen::VectorReduction::XOR: llvmResult = irBuilder->CreateXorReduce(llvmSrc); break;
+      default: throw EXCEPTION(GenericException, S("Invalid operation."));
+    }
+  } else if (tgElementType->isDerivedFrom<FloatType>()) {
+    auto llvmElementType = tgElementType->getLlvmType();
+    switch (op.get()) {
+      case CodeGen::VectorReduction::ADD:
+        // -0.0 is the identity of floating point addition.
+        llvmResult = irBuilder->CreateFAddReduce(llvm::ConstantFP::getNegativeZero(llvmElementType), llvmSrc);
+        break;
+      case CodeGen::VectorReduction::MUL:
+        llvmResult = irBuilder->CreateFMulReduce(llvm::ConstantFP::get(llvmElementType, 1.0), llvmSrc);
+        break;
+      case CodeGen::VectorReduction::MIN: llvmResult = irBuilder->CreateFPMinReduce(llvmSrc); break;
+      case CodeGen::VectorReduction::MAX: llvmResult = irBuilder->CreateFPMaxReduce(llvmSrc); break;
+      default: throw EXCEPTION(GenericException, S("Invalid operation."));
+    }
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid operation."));
+  }
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+//==============================================================================
+// Atomic Ops Generation Functions
+
+Bool TargetGenerator::generateAtomicLoad(
+  TiObject *context, TiObject *contentType, TiObject *srcRef, CodeGen::AtomicOrdering ordering,
+  TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(contentType, tgContentType, Type);
+  PREPARE_ARG(srcRef, srcRefBox, Value);
+  // Atomic accesses require an explicit alignment, which is the natural alignment of the type.
+  auto llvmType = tgContentType->getLlvmType();
+  auto llvmLoad = block->getIrBuilder()->CreateAlignedLoad(
+    llvmType, srcRefBox->getLlvmValue(),
+    llvm::MaybeAlign(this->buildTarget->getLlvmDataLayout()->getTypeStoreSize(llvmType))
+  );
+  llvmLoad->setAtomic(this->getLlvmAtomicOrdering(ordering));
+  result = newSrdObj<Value>(llvmLoad, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicStore(
+  TiObject *context, TiObject *contentType, TiObject *srcVal, TiObject *destRef, CodeGen::AtomicOrdering ordering
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(contentType, tgContentType, Type);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  auto llvmType = tgContentType->getLlvmType();
+  auto llvmStore = block->getIrBuilder()->CreateAlignedStore(
+    srcValBox->getLlvmValue(), destRefBox->getLlvmValue(),
+    llvm::MaybeAlign(this->buildTarget->getLlvmDataLayout()->getTypeStoreSize(llvmType))
+  );
+  llvmStore->setAtomic(this->getLlvmAtomicOrdering(ordering));
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicRmw(
+  TiObject *context, TiObject *contentType, CodeGen::AtomicOperation op, TiObject *srcVal, TiObject *destRef,
+  CodeGen::AtomicOrdering ordering, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(contentType, tgContentType, Type);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  auto irBuilder = block->getIrBuilder();
+
+  auto tgIntType = ti_cast<IntegerType>(tgContentType);
+  Bool isSigned = tgIntType != 0 && tgIntType->isSigned();
+  llvm::AtomicRMWInst::BinOp llvmOp;
+  switch (op.get()) {
+    case CodeGen::AtomicOperation::XCHG: llvmOp = llvm::AtomicRMWInst::Xchg; break;
+    case CodeGen::AtomicOperation::ADD: llvmOp = llvm::AtomicRMWInst::Add; break;
+    case CodeGen::AtomicOperation::SUB: llvmOp = llvm::AtomicRMWInst::Sub; break;
+    case CodeGen::AtomicOperation::AND: llvmOp = llvm::AtomicRMWInst::And; break;
+    case CodeGen::AtomicOperation::OR: llvmOp = llvm::AtomicRMWInst::Or; break;
+    case CodeGen::AtomicOperation::XOR: llvmOp = llvm::AtomicRMWInst::Xor; break;
+    case CodeGen::AtomicOperation::MIN: llvmOp = isSigned ? llvm::AtomicRMWInst::Min : llvm::AtomicRMWInst::UMin; break;
+    case CodeGen::AtomicOperation::MAX: llvmOp = isSigned ? llvm::AtomicRMWInst::Max : llvm::AtomicRMWInst::UMax; break;
+    default: throw EXCEPTION(GenericException, S("Invalid operation."));
+  }
+
+  // atomicrmw only accepts integers, so pointers are exchanged as integers of the same size.
+  auto llvmType = tgContentType->getLlvmType();
+  auto llvmSrc = srcValBox->getLlvmValue();
+  auto llvmDest = destRefBox->getLlvmValue();
+  llvm::Type *llvmIntType = 0;
+  if (llvmType->isPointerTy()) {
+    llvmIntType = this->buildTarget->getLlvmDataLayout()->getIntPtrType(llvmType);
+    llvmSrc = irBuilder->CreatePtrToInt(llvmSrc, llvmIntType);
+    llvmDest = irBuilder->CreateBitCast(llvmDest, llvmIntType->getPointerTo());
+  }
+  llvm::Value *llvmResult = irBuilder->CreateAtomicRMW(
+    llvmOp, llvmDest, llvmSrc, this->getLlvmAtomicOrdering(ordering)
+  );
+  if (llvmIntType != 0) llvmResult = irBuilder->CreateIntToPtr(llvmResult, llvmType);
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicCmpXchg(
+  TiObject *context, TiObject *contentType, TiObject *cmpVal, TiObject *newVal, TiObject *destRef,
+  CodeGen::AtomicOrdering ordering, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(cmpVal, cmpValBox, Value);
+  PREPARE_ARG(newVal, newValBox, Value);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  auto irBuilder = block->getIrBuilder();
+  // The failure ordering can't be a release ordering, so we use the strongest one allowed by the given ordering.
+  auto llvmOrdering = this->getLlvmAtomicOrdering(ordering);
+  auto llvmCmpXchg = irBuilder->CreateAtomicCmpXchg(
+    destRefBox->getLlvmValue(), cmpValBox->getLlvmValue(), newValBox->getLlvmValue(), llvmOrdering,
+    llvm::AtomicCmpXchgInst::getStrongestFailureOrdering(llvmOrdering)
+  );
+  result = newSrdObj<Value>(irBuilder->CreateExtractValue(llvmCmpXchg, 0), false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateFence(TiObject *context, CodeGen::AtomicOrdering ordering)
+{
+  PREPARE_ARG(context, block, Block);
+  block->getIrBuilder()->CreateFence(this->getLlvmAtomicOrdering(ordering));
+  return true;
+}
+
+
 //==============================================================================
 // Literal Generation Functions
 
@@ -1962,6 +2654,25 @@ Bool TargetGenerator::generateArrayLiteral(
 }
 
 
+Bool TargetGenerator::generateVectorLiteral(
+  TiObject *context, TiObject *type, Containing<TiObject> *elementVals, TioSharedPtr &destVal
+) {
+  PREPARE_ARG(type, tgType, VectorType);
+  VALIDATE_NOT_NULL(elementVals);
+  std::vector<llvm::Constant*> vectorVals;
+  for (Int i = 0; i < elementVals->getElementCount(); ++i) {
+    auto value = ti_cast<Value>(elementVals->getElement(i));
+    if (value == 0) {
+      throw EXCEPTION(GenericException, S("Unexpected element value received."));
+    }
+    vectorVals.push_back(value->getLlvmConstant());
+  }
+  auto llvmResult = llvm::ConstantVector::get(vectorVals);
+  destVal = newSrdObj<Value>(llvmResult, true);
+  return true;
+}
+
+
 Bool TargetGenerator::generatePointerLiteral(TiObject *context, TiObject *type, void *value, TioSharedPtr &destVal)
 {
   PREPARE_ARG(type, tgType, PointerType);
@@ -1986,4 +2697,74 @@ std::string TargetGenerator::getAnonymouseVarName()
   return std::string("#anonymous") + std::to_string(this->anonymousVarIndex++);
 }
 
+
+TiObject* TargetGenerator::getScalarType(TiObject *type)
+{
+  // Operations on vectors are element-wise, so they are generated based on the element type.
+  auto vectorType = ti_cast<VectorType>(type);
+  if (vectorType != 0) return vectorType->getElementType().get();
+  else return type;
+}
+
+
+llvm::AtomicOrdering TargetGenerator::getLlvmAtomicOrdering(CodeGen::AtomicOrdering ordering)
+{
+  switch (ordering.get()) {
+    case CodeGen::AtomicOrdering::RELAXED: return llvm::AtomicOrdering::Monotonic;
+    case CodeGen::AtomicOrdering::ACQUIRE: return llvm::AtomicOrdering::Acquire;
+    case CodeGen::AtomicOrdering::RELEASE: return llvm::AtomicOrdering::Release;
+    case CodeGen::AtomicOrdering::ACQ_REL: return llvm::AtomicOrdering::AcquireRelease;
+    case CodeGen::AtomicOrdering::SEQ_CST: return llvm::AtomicOrdering::SequentiallyConsistent;
+    default: throw EXCEPTION(InvalidArgumentException, S("ordering"), S("Invalid atomic ordering."));
+  }
+}
+
+
+llvm::AllocaInst* TargetGenerator::createEntryAlloca(Block *block, llvm::Type *type, Char const *name)
+{
+  // Allocas are kept together at the top of the entry block, in creation order, so that the stack doesn't grow
+  // inside loops and so that mem2reg and SROA can promote them.
+  auto function = block->getFunction();
+  auto &llvmEntryBlock = function->getLlvmFunction()->getEntryBlock();
+  llvm::IRBuilder<> builder(*this->buildTarget->getLlvmContext());
+  if (function->llvmLastEntryAlloca != 0) {
+    builder.SetInsertPoint(&llvmEntryBlock, ++llvm::BasicBlock::iterator(function->llvmLastEntryAlloca));
+  } else {
+    builder.SetInsertPoint(&llvmEntryBlock, llvmEntryBlock.getFirstInsertionPt());
+  }
+  function->llvmLastEntryAlloca = builder.CreateAlloca(type, 0, name);
+  return function->llvmLastEntryAlloca;
+}
+
+
+llvm::AllocaInst* TargetGenerator::getCleanupSelector(Block *block)
+{
+  auto function = block->getFunction();
+  if (function->llvmCleanupSelector == 0) {
+    function->llvmCleanupSelector = this->createEntryAlloca(
+      block, llvm::Type::getInt32Ty(*this->buildTarget->getLlvmContext()), "#cleanupSelector"
+    );
+  }
+  return function->llvmCleanupSelector;
+}
+
+
+llvm::IRBuilder<>* TargetGenerator::createIrBuilder(Block *parentBlock, llvm::BasicBlock *llvmBlock)
+{
+  auto irBuilder = new llvm::IRBuilder<>(llvmBlock);
+  irBuilder->SetCurrentDebugLocation(parentBlock->getIrBuilder()->getCurrentDebugLocation());
+  return irBuilder;
+}
+
+
+Core::Data::SourceLocationRecord* TargetGenerator::getSourceLocationRecord(Core::Data::SourceLocation *sl)
+{
+  // Like notices, the last entry of a stack is the primary location.
+  while (sl != 0 && sl->isDerivedFrom<Core::Data::SourceLocationStack>()) {
+    auto stack = static_cast<Core::Data::SourceLocationStack*>(sl);
+    sl = stack->getCount() == 0 ? 0 : stack->get(stack->getCount() - 1).get();
+  }
+  return static_cast<Core::Data::SourceLocationRecord*>(sl);
+}
+
 } // namespace
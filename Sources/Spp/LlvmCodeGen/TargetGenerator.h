@@ -100,6 +100,8 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: Bool generateArrayType(TiObject *contentType, Word size, TioSharedPtr &type);
 
+  public: Bool generateVectorType(TiObject *elementType, Word size, TioSharedPtr &type);
+
   public: Bool generateStructTypeDecl(
     Char const *name, TioSharedPtr &type
   );
@@ -122,10 +124,20 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     MapContaining<TiObject>* argTypes, TiObject *retType, Bool variadic, TioSharedPtr &functionType
   );
 
+  public: Bool generateFunctionArgAttributes(TiObject *functionType, Word argIndex, Word attributes);
+
   public: Bool generateFunctionDecl(
     Char const *name, TiObject *functionType, TioSharedPtr &function
   );
 
+  public: Bool generateIntrinsicFunctionDecl(
+    Char const *name, TiObject *functionType, TioSharedPtr &function
+  );
+
+  public: Bool generateFunctionAttributes(TiObject *function, Word attributes);
+
+  private: void applyFunctionAttributes(llvm::Function *llvmFunc, Function *funcWrapper);
+
   public: Bool prepareFunctionBody(
     TiObject *function, TiObject *functionType, SharedList<TiObject> *args, TioSharedPtr &context
   );
@@ -136,6 +148,8 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: Bool deleteFunction(TiObject *function);
 
+  public: Bool exportFunction(TiObject *function);
+
   /// @}
 
   /// @name Variable Definition Generation Functions
@@ -149,6 +163,28 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     TiObject *context, TiObject *type, Char const* name, TiObject *defaultValue, TioSharedPtr &result
   );
 
+  public: Bool generateVarLifetimeStart(TiObject *context, TiObject *varDefinition);
+
+  public: Bool generateVarLifetimeEnd(TiObject *context, TiObject *varDefinition);
+
+  /// @}
+
+  /// @name Debug Info Generation Functions
+  /// @{
+
+  public: Bool prepareFunctionDebugInfo(
+    TiObject *function, TiObject *functionType, TiObject *context, Core::Data::SourceLocation *sourceLocation
+  );
+
+  public: Bool setDebugLocation(TiObject *context, Core::Data::SourceLocation *sourceLocation);
+
+  public: Bool generateVarDebugInfo(
+    TiObject *context, TiObject *varDefinition, TiObject *type, Char const *name, Word argNumber,
+    Core::Data::SourceLocation *sourceLocation
+  );
+
+  private: llvm::DIScope* getDebugScope(llvm::DISubprogram *diSubprogram, Core::Data::SourceLocationRecord *record);
+
   /// @}
 
   /// @name Statements Generation Functions
@@ -163,9 +199,20 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
   public: Bool prepareForStatement(TiObject *context, SharedPtr<CodeGen::LoopTgContext> &loopTgContext);
   public: Bool finishForStatement(TiObject *context, CodeGen::LoopTgContext *loopTgContext, TiObject *conditionVal);
 
+  public: Bool generateLoopHints(
+    CodeGen::LoopTgContext *loopTgContext, Word hints, Word unrollCount, Word vectorizeWidth
+  );
+
+  private: void applyLoopHints(LoopContext *loopContext, llvm::Instruction *llvmEntryBranch);
+
   public: Bool generateContinue(TiObject *context, CodeGen::LoopTgContext *loopTgContext);
   public: Bool generateBreak(TiObject *context, CodeGen::LoopTgContext *loopTgContext);
 
+  public: Bool prepareCleanupBlock(TiObject *context, TioSharedPtr &cleanupContext);
+  public: Bool finishCleanupBlock(TiObject *cleanupContext, TiObject *exitContext);
+  public: Bool addCleanupBlockExit(TiObject *cleanupContext, Word selector, TiObject *targetContext);
+  public: Bool generateCleanupJump(TiObject *context, TiObject *cleanupContext, Word selector);
+
   /// @}
 
   /// @name Casting Generation Functions
@@ -383,6 +430,47 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   /// @}
 
+  /// @name Vector Ops Generation Functions
+  /// @{
+
+  public: Bool generateVectorSplat(TiObject *context, TiObject *vectorType, TiObject *srcVal, TioSharedPtr &result);
+
+  public: Bool generateVectorShuffle(
+    TiObject *context, TiObject *srcVal1, TiObject *srcVal2, Containing<TiObject> *indices, TioSharedPtr &result
+  );
+
+  public: Bool generateVectorReduction(
+    TiObject *context, TiObject *vectorType, CodeGen::VectorReduction op, TiObject *srcVal, TioSharedPtr &result
+  );
+
+  /// @}
+
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: Bool generateAtomicLoad(
+    TiObject *context, TiObject *contentType, TiObject *srcRef, CodeGen::AtomicOrdering ordering,
+    TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicStore(
+    TiObject *context, TiObject *contentType, TiObject *srcVal, TiObject *destRef, CodeGen::AtomicOrdering ordering
+  );
+
+  public: Bool generateAtomicRmw(
+    TiObject *context, TiObject *contentType, CodeGen::AtomicOperation op, TiObject *srcVal, TiObject *destRef,
+    CodeGen::AtomicOrdering ordering, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicCmpXchg(
+    TiObject *context, TiObject *contentType, TiObject *cmpVal, TiObject *newVal, TiObject *destRef,
+    CodeGen::AtomicOrdering ordering, TioSharedPtr &result
+  );
+
+  public: Bool generateFence(TiObject *context, CodeGen::AtomicOrdering ordering);
+
+  /// @}
+
   /// @name Literal Generation Functions
   /// @{
 
@@ -412,6 +500,10 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
     TioSharedPtr &destVal
   );
 
+  public: Bool generateVectorLiteral(
+    TiObject *context, TiObject *type, Containing<TiObject> *elementVals, TioSharedPtr &destVal
+  );
+
   public: Bool generatePointerLiteral(TiObject *context, TiObject *type, void *value, TioSharedPtr &destVal);
 
   /// @}
@@ -423,6 +515,20 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   private: std::string getAnonymouseVarName();
 
+  private: TiObject* getScalarType(TiObject *type);
+
+  private: llvm::AtomicOrdering getLlvmAtomicOrdering(CodeGen::AtomicOrdering ordering);
+
+  private: llvm::AllocaInst* createEntryAlloca(Block *block, llvm::Type *type, Char const *name);
+
+  /// Returns the function's var that holds the selector of the cleanup blocks, creating it on first use.
+  private: llvm::AllocaInst* getCleanupSelector(Block *block);
+
+  /// Creates the IR builder of a child block, carrying over the current debug location of the parent block.
+  private: llvm::IRBuilder<>* createIrBuilder(Block *parentBlock, llvm::BasicBlock *llvmBlock);
+
+  private: static Core::Data::SourceLocationRecord* getSourceLocationRecord(Core::Data::SourceLocation *sl);
+
   /// @}
 
 }; // class
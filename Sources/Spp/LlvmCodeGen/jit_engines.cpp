@@ -51,6 +51,8 @@ Error JitEngineBuilderState::prepareForConstruction() {
 // JitEngine Functions
 
 JitEngine::~JitEngine() {
+  if (tierUpThread)
+    tierUpThread->wait();
   if (compileThreads)
     compileThreads->wait();
 }
@@ -69,6 +71,9 @@ Error JitEngine::addIRModule(JITDylib &jd, ThreadSafeModule tsm) {
   if (auto err = tsm.withModuleDo([&](Module &m) { return applyDataLayout(m); }))
     return err;
 
+  if (tierUpThreshold > 0 && stubsMgr)
+    return addTieredIRModule(jd, std::move(tsm));
+
   if (optimizeLayer.get() != 0) {
     return optimizeLayer->add(jd, std::move(tsm), es->allocateVModule());
   } else {
@@ -86,6 +91,9 @@ Error JitEngine::addObjectFile(JITDylib &jd, std::unique_ptr<MemoryBuffer> obj)
 
 Expected<JITEvaluatedSymbol> JitEngine::lookupLinkerMangled(JITDylib &jd,
                                                         StringRef name) {
+  if (auto err = resolvePendingStubs())
+    return std::move(err);
+
   return es->lookup(
       makeJITDylibSearchOrder(&jd, JITDylibLookupFlags::MatchAllSymbols),
       es->intern(name));
@@ -108,6 +116,9 @@ std::unique_ptr<ObjectLayer> JitEngine::createObjectLinkingLayer(JitEngineBuilde
     objLinkingLayer->setAutoClaimResponsibilityForObjectSymbols(true);
   }
 
+  for (auto listener : s.eventListeners)
+    objLinkingLayer->registerJITEventListener(*listener);
+
   // FIXME: Explicit conversion to std::unique_ptr<ObjectLayer> added to silence
   //        errors from some GCC / libstdc++ bots. Remove this conversion (i.e.
   //        just return objLinkingLayer) once those bots are upgraded.
@@ -122,16 +133,9 @@ Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> JitEngine::createCompileFu
   if (s.createCompileFunction)
     return s.createCompileFunction(std::move(jtmb));
 
-  // Otherwise default to creating a SimpleCompiler, or ConcurrentIRCompiler,
-  // depending on the number of threads requested.
-  if (s.numCompileThreads > 0)
-    return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb));
-
-  auto TM = jtmb.createTargetMachine();
-  if (!TM)
-    return TM.takeError();
-
-  return std::make_unique<TMOwningSimpleCompiler>(std::move(*TM));
+  // Otherwise default to creating a ConcurrentIRCompiler so that compile
+  // threads can be enabled at any time.
+  return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb), s.objectCache);
 }
 
 
@@ -151,6 +155,23 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
     return;
   }
 
+  // Tiered compilation emits its baseline code without optimization, so it
+  // gets its own compile layer, and calls are routed through stubs so that
+  // they can be redirected to optimized code later.
+  {
+    auto baselineJtmb = *s.jtmb;
+    baselineJtmb.setCodeGenOptLevel(CodeGenOpt::None);
+    baselineCompileLayer = std::make_unique<IRCompileLayer>(
+        *es, objTransformLayer, std::make_unique<ConcurrentIRCompiler>(std::move(baselineJtmb)));
+    if (auto ismBuilder = createLocalIndirectStubsManagerBuilder(s.jtmb->getTargetTriple()))
+      stubsMgr = ismBuilder();
+    if (auto err2 = defineAbsolute(mangle("__AlususJitTierUp"), JITEvaluatedSymbol(
+          pointerToJITTargetAddress(&JitEngine::requestTierUp), JITSymbolFlags::Exported))) {
+      err = std::move(err2);
+      return;
+    }
+  }
+
   {
     auto compileFunction = createCompileFunction(s, std::move(*s.jtmb));
     if (!compileFunction) {
@@ -161,18 +182,19 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
         *es, objTransformLayer, std::move(*compileFunction));
   }
 
-  if (s.numCompileThreads > 0) {
-    compileLayer->setCloneToNewContextOnEmit(true);
-    compileThreads = std::make_unique<ThreadPool>(s.numCompileThreads);
-    es->setDispatchMaterialization(
-      [this](JITDylib &jd, std::unique_ptr<MaterializationUnit> mu) {
-        // FIXME: Switch to move capture once we have c++14.
-        auto sharedMu = std::shared_ptr<MaterializationUnit>(std::move(mu));
-        auto work = [sharedMu, &jd]() { sharedMu->doMaterialize(jd); };
-        compileThreads->async(std::move(work));
+  setNumCompileThreads(s.numCompileThreads);
+  es->setDispatchMaterialization(
+    [this](JITDylib &jd, std::unique_ptr<MaterializationUnit> mu) {
+      if (!compileThreads) {
+        mu->doMaterialize(jd);
+        return;
       }
-    );
-  }
+      // FIXME: Switch to move capture once we have c++14.
+      auto sharedMu = std::shared_ptr<MaterializationUnit>(std::move(mu));
+      auto work = [sharedMu, &jd]() { sharedMu->doMaterialize(jd); };
+      compileThreads->async(std::move(work));
+    }
+  );
 
   if (useOptimizeLayer) {
     optimizeLayer = createOptimizeLayer(*compileLayer);
@@ -180,6 +202,224 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
 }
 
 
+void JitEngine::setNumCompileThreads(unsigned numCompileThreads) {
+  // Let pending work finish before replacing the pool.
+  if (compileThreads)
+    compileThreads->wait();
+
+  this->numCompileThreads = numCompileThreads;
+  if (numCompileThreads > 0)
+    compileThreads = std::make_unique<ThreadPool>(numCompileThreads);
+  else
+    compileThreads.reset();
+
+  // Modules compiled concurrently need their own contexts.
+  compileLayer->setCloneToNewContextOnEmit(numCompileThreads > 0);
+  baselineCompileLayer->setCloneToNewContextOnEmit(numCompileThreads > 0);
+}
+
+
+void JitEngine::setTierUpThreshold(Word threshold) {
+  this->tierUpThreshold = std::min(threshold, (Word)std::numeric_limits<int32_t>::max());
+  // Optimized code is compiled on its own thread so it never waits behind
+  // the work it is meant to replace.
+  if (threshold > 0 && !tierUpThread)
+    tierUpThread = std::make_unique<ThreadPool>(1);
+}
+
+
+Error JitEngine::addTieredIRModule(JITDylib &jd, ThreadSafeModule tsm) {
+  // Only functions with external linkage are called through stubs. Modules
+  // with mutable local globals are optimized up front since the optimized
+  // copy would otherwise get its own instance of these globals.
+  std::vector<std::string> functionNames;
+  Bool tierable = true;
+  tsm.withModuleDo([&](Module &m) {
+    for (auto &gv : m.globals()) {
+      if (gv.hasLocalLinkage() && !gv.isConstant())
+        tierable = false;
+    }
+    for (auto &f : m.functions()) {
+      if (!f.isDeclaration() && f.hasExternalLinkage())
+        functionNames.push_back(f.getName().str());
+    }
+  });
+  if (!tierable || functionNames.empty()) {
+    if (optimizeLayer.get() != 0)
+      return optimizeLayer->add(jd, std::move(tsm));
+    return compileLayer->add(jd, std::move(tsm));
+  }
+
+  // Keep a copy of the module in its own context to be optimized later.
+  auto unit = std::make_unique<TierUpUnit>();
+  unit->jd = &jd;
+  unit->optimizedModule = cloneToNewContext(tsm);
+  unit->optimizedModule.withModuleDo([&](Module &m) { prepareOptimizedModule(m, functionNames); });
+  unit->functionNames = functionNames;
+  unit->scheduled = false;
+
+  Word unitIndex;
+  {
+    std::lock_guard<std::mutex> lock(tierUpMutex);
+    unitIndex = tierUpUnits.size();
+    tierUpUnits.push_back(std::move(unit));
+  }
+
+  tsm.withModuleDo([&](Module &m) { instrumentBaselineModule(m, functionNames, unitIndex); });
+
+  // Define the stubs under the functions' original names. They get pointed
+  // to the baseline code on the next lookup, which compiles all pending
+  // modules together.
+  IndirectStubsManager::StubInitsMap stubInits;
+  for (auto &name : functionNames)
+    stubInits[name] = std::make_pair(JITTargetAddress(0), JITSymbolFlags::Exported | JITSymbolFlags::Callable);
+  if (auto err = stubsMgr->createStubs(stubInits))
+    return err;
+  SymbolMap stubSymbols;
+  for (auto &name : functionNames)
+    stubSymbols[es->intern(mangle(name))] = stubsMgr->findStub(name, false);
+  if (auto err = jd.define(absoluteSymbols(std::move(stubSymbols))))
+    return err;
+  {
+    std::lock_guard<std::mutex> lock(tierUpMutex);
+    for (auto &name : functionNames)
+      pendingStubs.push_back(std::make_pair(&jd, name));
+  }
+
+  return baselineCompileLayer->add(jd, std::move(tsm));
+}
+
+
+void JitEngine::instrumentBaselineModule(
+  Module &m, std::vector<std::string> const &functionNames, Word unitIndex
+) {
+  auto &context = m.getContext();
+  auto int32Type = llvm::Type::getInt32Ty(context);
+  auto int64Type = llvm::Type::getInt64Ty(context);
+  auto tierUpCallee = m.getOrInsertFunction(
+    "__AlususJitTierUp", llvm::FunctionType::get(llvm::Type::getVoidTy(context), { int64Type, int64Type }, false)
+  );
+  auto unlikely = MDBuilder(context).createBranchWeights(1, 1000000);
+
+  for (auto &name : functionNames) {
+    // Move the body out of the way and redirect all its uses, including calls
+    // from within this module, to the stub.
+    auto func = m.getFunction(name);
+    func->setName(name + "$tier0");
+    auto stubDecl = llvm::Function::Create(func->getFunctionType(), GlobalValue::ExternalLinkage, name, &m);
+    stubDecl->setCallingConv(func->getCallingConv());
+    stubDecl->setAttributes(func->getAttributes());
+    func->replaceAllUsesWith(stubDecl);
+
+    // Count the calls, skipping the allocas to keep them in the entry block,
+    // and request the tier up once the threshold is reached.
+    auto counter = new GlobalVariable(
+      m, int32Type, false, GlobalValue::InternalLinkage, ConstantInt::get(int32Type, 0), name + "$calls"
+    );
+    auto insertPoint = func->getEntryBlock().getFirstInsertionPt();
+    while (isa<AllocaInst>(*insertPoint))
+      ++insertPoint;
+    IRBuilder<> builder(&*insertPoint);
+    auto count = builder.CreateAdd(builder.CreateLoad(int32Type, counter), ConstantInt::get(int32Type, 1));
+    builder.CreateStore(count, counter);
+    auto reached = builder.CreateICmpEQ(count, ConstantInt::get(int32Type, tierUpThreshold));
+    builder.SetInsertPoint(SplitBlockAndInsertIfThen(reached, &*insertPoint, false, unlikely));
+    builder.CreateCall(tierUpCallee, {
+      ConstantInt::get(int64Type, (uint64_t)this), ConstantInt::get(int64Type, unitIndex)
+    });
+  }
+}
+
+
+void JitEngine::prepareOptimizedModule(Module &m, std::vector<std::string> const &functionNames) {
+  // Globals are owned by the baseline module, so the optimized copy only
+  // refers to them.
+  std::vector<GlobalVariable*> appendingVars;
+  for (auto &gv : m.globals()) {
+    if (gv.hasAppendingLinkage()) {
+      appendingVars.push_back(&gv);
+    } else if (!gv.hasLocalLinkage() && !gv.isDeclaration()) {
+      gv.setInitializer(nullptr);
+      gv.setLinkage(GlobalValue::ExternalLinkage);
+      gv.setComdat(nullptr);
+    }
+  }
+  for (auto gv : appendingVars)
+    gv->eraseFromParent();
+
+  // Calls within the module go directly to the optimized functions while
+  // other modules reach them through the stubs.
+  for (auto &name : functionNames)
+    m.getFunction(name)->setName(name + "$tier1");
+}
+
+
+Error JitEngine::resolvePendingStubs() {
+  std::vector<std::pair<JITDylib*, std::string>> pending;
+  {
+    std::lock_guard<std::mutex> lock(tierUpMutex);
+    pending.swap(pendingStubs);
+  }
+
+  // Look up all baseline functions at once so that their modules get
+  // compiled concurrently when compile threads are enabled.
+  for (Word i = 0; i < pending.size();) {
+    auto jd = pending[i].first;
+    SymbolLookupSet names;
+    Word end = i;
+    while (end < pending.size() && pending[end].first == jd)
+      names.add(es->intern(mangle(pending[end++].second + "$tier0")));
+    auto symbols = es->lookup(makeJITDylibSearchOrder(jd, JITDylibLookupFlags::MatchAllSymbols), names);
+    if (!symbols)
+      return symbols.takeError();
+    for (; i < end; ++i) {
+      auto &symbol = (*symbols)[es->intern(mangle(pending[i].second + "$tier0"))];
+      if (auto err = stubsMgr->updatePointer(pending[i].second, symbol.getAddress()))
+        return err;
+    }
+  }
+  return Error::success();
+}
+
+
+void JitEngine::tierUp(TierUpUnit *unit) {
+  auto &layer = optimizeLayer.get() != 0 ? (IRLayer&)*optimizeLayer : (IRLayer&)*compileLayer;
+  if (auto err = layer.add(*unit->jd, std::move(unit->optimizedModule))) {
+    logAllUnhandledErrors(std::move(err), errs(), "JIT tier up failed: ");
+    return;
+  }
+
+  SymbolLookupSet names;
+  for (auto &name : unit->functionNames)
+    names.add(es->intern(mangle(name + "$tier1")));
+  auto symbols = es->lookup(makeJITDylibSearchOrder(unit->jd, JITDylibLookupFlags::MatchAllSymbols), names);
+  if (!symbols) {
+    logAllUnhandledErrors(symbols.takeError(), errs(), "JIT tier up failed: ");
+    return;
+  }
+
+  // Calls already running in the baseline code finish there while new calls
+  // go to the optimized code.
+  for (auto &name : unit->functionNames) {
+    auto &symbol = (*symbols)[es->intern(mangle(name + "$tier1"))];
+    if (auto err = stubsMgr->updatePointer(name, symbol.getAddress()))
+      logAllUnhandledErrors(std::move(err), errs(), "JIT tier up failed: ");
+  }
+}
+
+
+void JitEngine::requestTierUp(JitEngine *engine, Word unitIndex) {
+  TierUpUnit *unit;
+  {
+    std::lock_guard<std::mutex> lock(engine->tierUpMutex);
+    unit = engine->tierUpUnits[unitIndex].get();
+  }
+  if (unit->scheduled.exchange(true))
+    return;
+  engine->tierUpThread->async([engine, unit]() { engine->tierUp(unit); });
+}
+
+
 std::unique_ptr<llvm::orc::IRTransformLayer> JitEngine::createOptimizeLayer(llvm::orc::IRLayer &prevLayer) {
   auto optimizeLayer = std::make_unique<IRTransformLayer>(*es, prevLayer);
 
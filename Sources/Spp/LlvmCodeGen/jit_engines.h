@@ -19,6 +19,20 @@ class JitEngine
 {
   template <typename, typename, typename> friend class JitEngineBuilderSetters;
 
+  //============================================================================
+  // Types
+
+  /// A fully optimized copy of a module added in tiered mode, compiled when
+  /// any of its functions gets hot.
+  protected: struct TierUpUnit
+  {
+    llvm::orc::JITDylib *jd;
+    llvm::orc::ThreadSafeModule optimizedModule;
+    std::vector<std::string> functionNames;
+    std::atomic<Bool> scheduled;
+  };
+
+
   //============================================================================
   // Member Variables
 
@@ -26,6 +40,7 @@ class JitEngine
   protected: llvm::orc::JITDylib &main;
 
   protected: llvm::DataLayout dl;
+  protected: unsigned numCompileThreads = 0;
   protected: std::unique_ptr<llvm::ThreadPool> compileThreads;
 
   protected: std::unique_ptr<llvm::orc::ObjectLayer> objLinkingLayer;
@@ -35,6 +50,14 @@ class JitEngine
 
   protected: llvm::orc::CtorDtorRunner ctorRunner, dtorRunner;
 
+  protected: Word tierUpThreshold = 0;
+  protected: std::unique_ptr<llvm::orc::IRCompileLayer> baselineCompileLayer;
+  protected: std::unique_ptr<llvm::orc::IndirectStubsManager> stubsMgr;
+  protected: std::unique_ptr<llvm::ThreadPool> tierUpThread;
+  protected: std::mutex tierUpMutex;
+  protected: std::vector<std::unique_ptr<TierUpUnit>> tierUpUnits;
+  protected: std::vector<std::pair<llvm::orc::JITDylib*, std::string>> pendingStubs;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -129,6 +152,33 @@ class JitEngine
     return dtorRunner.run();
   }
 
+  /// Sets the number of compile threads.
+  ///
+  /// Can be changed after construction. Zero means compilation is performed on
+  /// the thread requesting the symbols. Any other number N dispatches the
+  /// materialization of separately added modules to a pool of N threads.
+  public: void setNumCompileThreads(unsigned numCompileThreads);
+
+  /// Returns the number of compile threads.
+  public: unsigned getNumCompileThreads() const {
+    return compileThreads ? numCompileThreads : 0;
+  }
+
+  /// Sets the number of calls after which a function gets fully optimized.
+  ///
+  /// Zero disables tiered compilation, in which case modules are optimized
+  /// before their first execution. Any other number N makes modules added
+  /// afterwards compile without optimization and count calls to their
+  /// functions. Calls go through stubs, and once a function is called N times
+  /// its module is optimized on a background thread and the stubs are
+  /// redirected to the optimized code.
+  public: void setTierUpThreshold(Word threshold);
+
+  /// Returns the number of calls after which a function gets fully optimized.
+  public: Word getTierUpThreshold() const {
+    return tierUpThreshold;
+  }
+
   /// Returns a reference to the objLinkingLayer
   public: llvm::orc::ObjectLayer &getObjLinkingLayer() {
     return *objLinkingLayer;
@@ -151,6 +201,20 @@ class JitEngine
 
   protected: std::string mangle(llvm::StringRef unmangledName);
 
+  protected: llvm::Error addTieredIRModule(llvm::orc::JITDylib &jd, llvm::orc::ThreadSafeModule tsm);
+
+  protected: void instrumentBaselineModule(
+    llvm::Module &m, std::vector<std::string> const &functionNames, Word unitIndex
+  );
+
+  protected: void prepareOptimizedModule(llvm::Module &m, std::vector<std::string> const &functionNames);
+
+  protected: llvm::Error resolvePendingStubs();
+
+  protected: void tierUp(TierUpUnit *unit);
+
+  protected: static void requestTierUp(JitEngine *engine, Word unitIndex);
+
   protected: llvm::Error applyDataLayout(llvm::Module &m);
 
   protected: void recordCtorDtors(llvm::Module &m);
@@ -220,6 +284,8 @@ class JitEngineBuilderState
   public: ObjectLinkingLayerCreator createObjectLinkingLayer;
   public: CompileFunctionCreator createCompileFunction;
   public: unsigned numCompileThreads = 0;
+  public: llvm::ObjectCache *objectCache = 0;
+  public: std::vector<llvm::JITEventListener*> eventListeners;
 
   /// Called prior to JIT class construcion to fix up defaults.
   public: llvm::Error prepareForConstruction();
@@ -289,9 +355,8 @@ class JitEngineBuilderSetters
   /// Set a CompileFunctionCreator.
   ///
   /// If this method is not called, a default creation function wil be used
-  /// that will construct a basic IR compile function that is compatible with
-  /// the selected number of threads (SimpleCompiler for '0' compile threads,
-  /// ConcurrentIRCompiler otherwise).
+  /// that will construct a ConcurrentIRCompiler, which allows the number of
+  /// compile threads to be changed after construction.
   public: SETTER_IMPL& setCompileFunctionCreator(
       JitEngineBuilderState::CompileFunctionCreator createCompileFunction) {
     impl().createCompileFunction = std::move(createCompileFunction);
@@ -311,6 +376,24 @@ class JitEngineBuilderSetters
     return impl();
   }
 
+  /// Set the cache used to store and load compiled objects.
+  ///
+  /// The cache is only used by the default compile function and must outlive
+  /// the JIT instance. If this method is not called, no cache is used.
+  public: SETTER_IMPL& setObjectCache(llvm::ObjectCache *objectCache) {
+    impl().objectCache = objectCache;
+    return impl();
+  }
+
+  /// Add a listener to be notified of the objects loaded by the JIT.
+  ///
+  /// Listeners are only supported by the default RTDyldObjectLinkingLayer and
+  /// must outlive the JIT instance.
+  public: SETTER_IMPL& addEventListener(llvm::JITEventListener *listener) {
+    impl().eventListeners.push_back(listener);
+    return impl();
+  }
+
   /// Create an instance of the JIT.
   public: llvm::Expected<std::unique_ptr<JIT_TYPE>> create(CodeGen::GlobalItemRepo *itemRepo) {
     if (auto err = impl().prepareForConstruction())
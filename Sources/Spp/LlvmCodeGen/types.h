@@ -251,6 +251,54 @@ class ArrayType : public Type
 }; // class
 
 
+//==============================================================================
+// VectorType
+
+class VectorType : public Type
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(VectorType, Type, "Spp.LlvmCodeGen", "Spp", "alusus.org");
+
+
+  //============================================================================
+  // Member Variables
+
+  private: llvm::VectorType *llvmType;
+  private: SharedPtr<Type> elementType;
+  private: Word size;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: VectorType(llvm::VectorType *t, SharedPtr<Type> const &et, Word s) : llvmType(t), elementType(et), size(s)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: virtual llvm::Type* getLlvmType() const
+  {
+    return this->llvmType;
+  }
+
+  public: SharedPtr<Type> const& getElementType() const
+  {
+    return this->elementType;
+  }
+
+  public: Word getSize() const
+  {
+    return this->size;
+  }
+
+}; // class
+
+
 //==============================================================================
 // StructType
 
@@ -311,6 +359,7 @@ class FunctionType : public Type
   private: SharedPtr<SharedMap<Type>> args;
   private: SharedPtr<Type> retType;
   private: Bool variadic;
+  private: std::vector<Word> argAttributes;
 
 
   //============================================================================
@@ -351,6 +400,17 @@ class FunctionType : public Type
     return this->variadic;
   }
 
+  public: void setArgAttributes(Word index, Word attributes)
+  {
+    if (this->argAttributes.size() <= index) this->argAttributes.resize(index + 1, 0);
+    this->argAttributes[index] = attributes;
+  }
+
+  public: Word getArgAttributes(Word index) const
+  {
+    return index < this->argAttributes.size() ? this->argAttributes[index] : 0;
+  }
+
 }; // class
 
 } // namespace
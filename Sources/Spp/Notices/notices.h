@@ -166,6 +166,9 @@ DEFINE_NOTICE(TemplateFunctionLacksBodyNotice, "Spp.Notices", "Spp", "alusus.org
 DEFINE_NOTICE(InvalidTemplateHandlerStatementNotice, "Spp.Notices", "Spp", "alusus.org", "SPPH1025", 1,
   "Template handler statement must not be a pointer."
 );
+DEFINE_NOTICE(InvalidMoveOpHandlerNotice, "Spp.Notices", "Spp", "alusus.org", "SPPH1026", 1,
+  "~move operations must take exactly one argument and cannot be pointer based."
+);
 
 } // namespace
 
@@ -300,6 +303,33 @@ DEFINE_NOTICE(CircularUserTypeCodeGenNotice, "Spp.Notices", "Spp", "alusus.org",
 DEFINE_NOTICE(UnexpectedTerminalStatementNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1041", 1,
   "Unexpected terminal statement encountered."
 );
+DEFINE_NOTICE(InvalidVectorElementTypeNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1042", 1,
+  "Invalid vector element type. Vector elements must be integers or floats."
+);
+DEFINE_NOTICE(InvalidVectorOperationNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1043", 1,
+  "Invalid vector operation."
+);
+DEFINE_NOTICE(InvalidAtomicOperandNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1044", 1,
+  "Invalid atomic operand. Atomic operations require a variable of an integer or pointer type."
+);
+DEFINE_NOTICE(InvalidAtomicOperationNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1045", 1,
+  "Invalid atomic operation."
+);
+DEFINE_NOTICE(InvalidAtomicOrderingNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1046", 1,
+  "Invalid memory ordering for the given atomic operation."
+);
+DEFINE_NOTICE(InvalidIntrinsicNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1047", 1,
+  "No intrinsic matches the given name and signature."
+);
+DEFINE_NOTICE(InvalidIntrinsicUsageNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1048", 1,
+  "Intrinsic functions can only be declared without a body and called directly."
+);
+DEFINE_NOTICE(InvalidMoveOperandNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1049", 1,
+  "Invalid operand for ~move operator."
+);
+DEFINE_NOTICE(TypeMissingMatchingMoveOpNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1050", 1,
+  "Moving failed. A ~move op matching the given value is needed for this type."
+);
 
 } // namespace
 
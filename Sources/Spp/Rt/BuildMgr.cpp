@@ -21,7 +21,21 @@ void BuildMgr::initBindingCaches()
 {
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
+    &this->dumpLlvmIrForElementWithFlags,
     &this->buildObjectFileForElement,
+    &this->buildObjectFileForElementWithFlags,
+    &this->buildObjectFilesForElement,
+    &this->buildObjectFilesForElementWithFlags,
+    &this->setCodeGenThreadCount,
+    &this->getCodeGenThreadCount,
+    &this->setJitThreadCount,
+    &this->getJitThreadCount,
+    &this->setJitTierUpThreshold,
+    &this->getJitTierUpThreshold,
+    &this->setJitCacheEnabled,
+    &this->isJitCacheEnabled,
+    &this->setJitCacheSizeLimit,
+    &this->getJitCacheSizeLimit,
     &this->raiseBuildNotice
   });
 }
@@ -30,7 +44,21 @@ void BuildMgr::initBindingCaches()
 void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
+  this->dumpLlvmIrForElementWithFlags = &BuildMgr::_dumpLlvmIrForElementWithFlags;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->buildObjectFileForElementWithFlags = &BuildMgr::_buildObjectFileForElementWithFlags;
+  this->buildObjectFilesForElement = &BuildMgr::_buildObjectFilesForElement;
+  this->buildObjectFilesForElementWithFlags = &BuildMgr::_buildObjectFilesForElementWithFlags;
+  this->setCodeGenThreadCount = &BuildMgr::_setCodeGenThreadCount;
+  this->getCodeGenThreadCount = &BuildMgr::_getCodeGenThreadCount;
+  this->setJitThreadCount = &BuildMgr::_setJitThreadCount;
+  this->getJitThreadCount = &BuildMgr::_getJitThreadCount;
+  this->setJitTierUpThreshold = &BuildMgr::_setJitTierUpThreshold;
+  this->getJitTierUpThreshold = &BuildMgr::_getJitTierUpThreshold;
+  this->setJitCacheEnabled = &BuildMgr::_setJitCacheEnabled;
+  this->isJitCacheEnabled = &BuildMgr::_isJitCacheEnabled;
+  this->setJitCacheSizeLimit = &BuildMgr::_setJitCacheSizeLimit;
+  this->getJitCacheSizeLimit = &BuildMgr::_getJitCacheSizeLimit;
   this->raiseBuildNotice = &BuildMgr::_raiseBuildNotice;
 }
 
@@ -39,7 +67,29 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
 {
   globalItemRepo->addItem(S("!Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_dumpLlvmIrForElementWithFlags"), (void*)&BuildMgr::_dumpLlvmIrForElementWithFlags
+  );
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFileForElementWithFlags"), (void*)&BuildMgr::_buildObjectFileForElementWithFlags
+  );
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFilesForElement"), (void*)&BuildMgr::_buildObjectFilesForElement
+  );
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFilesForElementWithFlags"), (void*)&BuildMgr::_buildObjectFilesForElementWithFlags
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_setCodeGenThreadCount"), (void*)&BuildMgr::_setCodeGenThreadCount);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getCodeGenThreadCount"), (void*)&BuildMgr::_getCodeGenThreadCount);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitThreadCount"), (void*)&BuildMgr::_setJitThreadCount);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitThreadCount"), (void*)&BuildMgr::_getJitThreadCount);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitTierUpThreshold"), (void*)&BuildMgr::_setJitTierUpThreshold);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitTierUpThreshold"), (void*)&BuildMgr::_getJitTierUpThreshold);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitCacheEnabled"), (void*)&BuildMgr::_setJitCacheEnabled);
+  globalItemRepo->addItem(S("Spp_BuildMgr_isJitCacheEnabled"), (void*)&BuildMgr::_isJitCacheEnabled);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitCacheSizeLimit"), (void*)&BuildMgr::_setJitCacheSizeLimit);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitCacheSizeLimit"), (void*)&BuildMgr::_getJitCacheSizeLimit);
   globalItemRepo->addItem(S("Spp_BuildMgr_raiseBuildNotice"), (void*)&BuildMgr::_raiseBuildNotice);
 }
 
@@ -50,7 +100,16 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
 void BuildMgr::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
 {
   PREPARE_SELF(buildMgr, BuildMgr);
-  buildMgr->buildManager->dumpLlvmIrForElement(element);
+  buildMgr->buildManager->dumpLlvmIrForElement(element, 0);
+}
+
+
+void BuildMgr::_dumpLlvmIrForElementWithFlags(TiObject *self, TiObject *element, Array<String> &flags)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Array<Str> codeGenFlags;
+  for (Int i = 0; i < flags.getLength(); ++i) codeGenFlags.add(Str(flags(i).getBuf()));
+  buildMgr->buildManager->dumpLlvmIrForElement(element, &codeGenFlags);
 }
 
 
@@ -58,7 +117,117 @@ Bool BuildMgr::_buildObjectFileForElement(
   TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
 ) {
   PREPARE_SELF(buildMgr, BuildMgr);
-  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple);
+  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple, 0, 0);
+}
+
+
+Bool BuildMgr::_buildObjectFileForElementWithFlags(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple, Array<String> &flags
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Array<Str> codeGenFlags;
+  for (Int i = 0; i < flags.getLength(); ++i) codeGenFlags.add(Str(flags(i).getBuf()));
+  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple, &codeGenFlags, 0);
+}
+
+
+Bool BuildMgr::_buildObjectFilesForElement(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Array<String> &objectFilenames
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Array<Str> filenames;
+  auto result = buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, 0, &filenames
+  );
+  for (Int i = 0; i < filenames.getLength(); ++i) objectFilenames.add(filenames(i));
+  return result;
+}
+
+
+Bool BuildMgr::_buildObjectFilesForElementWithFlags(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Array<String> &flags, Array<String> &objectFilenames
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Array<Str> codeGenFlags;
+  for (Int i = 0; i < flags.getLength(); ++i) codeGenFlags.add(Str(flags(i).getBuf()));
+  Array<Str> filenames;
+  auto result = buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, &codeGenFlags, &filenames
+  );
+  for (Int i = 0; i < filenames.getLength(); ++i) objectFilenames.add(filenames(i));
+  return result;
+}
+
+
+void BuildMgr::_setCodeGenThreadCount(TiObject *self, Word count)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setCodeGenThreadCount(count);
+}
+
+
+Word BuildMgr::_getCodeGenThreadCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getCodeGenThreadCount();
+}
+
+
+void BuildMgr::_setJitThreadCount(TiObject *self, Word count)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitThreadCount(count);
+}
+
+
+Word BuildMgr::_getJitThreadCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitThreadCount();
+}
+
+
+void BuildMgr::_setJitTierUpThreshold(TiObject *self, Word threshold)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitTierUpThreshold(threshold);
+}
+
+
+Word BuildMgr::_getJitTierUpThreshold(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitTierUpThreshold();
+}
+
+
+void BuildMgr::_setJitCacheEnabled(TiObject *self, Bool enabled)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitCacheEnabled(enabled);
+}
+
+
+Bool BuildMgr::_isJitCacheEnabled(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->isJitCacheEnabled();
+}
+
+
+void BuildMgr::_setJitCacheSizeLimit(TiObject *self, Word limit)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitCacheSizeLimit(limit);
+}
+
+
+Word BuildMgr::_getJitCacheSizeLimit(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitCacheSizeLimit();
 }
 
 
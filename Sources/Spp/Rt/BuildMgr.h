@@ -91,11 +91,67 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
   public: METHOD_BINDING_CACHE(dumpLlvmIrForElement, void, (TiObject*));
   public: static void _dumpLlvmIrForElement(TiObject *self, TiObject *element);
 
+  public: METHOD_BINDING_CACHE(dumpLlvmIrForElementWithFlags, void, (TiObject*, Array<String>& /* flags */));
+  public: static void _dumpLlvmIrForElementWithFlags(TiObject *self, TiObject *element, Array<String> &flags);
+
   public: METHOD_BINDING_CACHE(buildObjectFileForElement, Bool, (TiObject*, Char const*, Char const*));
   public: static Bool _buildObjectFileForElement(
     TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
   );
 
+  public: METHOD_BINDING_CACHE(buildObjectFileForElementWithFlags,
+    Bool, (TiObject*, Char const*, Char const*, Array<String>& /* flags */)
+  );
+  public: static Bool _buildObjectFileForElementWithFlags(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple, Array<String> &flags
+  );
+
+  public: METHOD_BINDING_CACHE(buildObjectFilesForElement,
+    Bool, (TiObject*, Char const*, Char const*, Array<String>& /* objectFilenames */)
+  );
+  public: static Bool _buildObjectFilesForElement(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Array<String> &objectFilenames
+  );
+
+  public: METHOD_BINDING_CACHE(buildObjectFilesForElementWithFlags,
+    Bool, (TiObject*, Char const*, Char const*, Array<String>& /* flags */, Array<String>& /* objectFilenames */)
+  );
+  public: static Bool _buildObjectFilesForElementWithFlags(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Array<String> &flags, Array<String> &objectFilenames
+  );
+
+  public: METHOD_BINDING_CACHE(setCodeGenThreadCount, void, (Word));
+  public: static void _setCodeGenThreadCount(TiObject *self, Word count);
+
+  public: METHOD_BINDING_CACHE(getCodeGenThreadCount, Word);
+  public: static Word _getCodeGenThreadCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitThreadCount, void, (Word));
+  public: static void _setJitThreadCount(TiObject *self, Word count);
+
+  public: METHOD_BINDING_CACHE(getJitThreadCount, Word);
+  public: static Word _getJitThreadCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitTierUpThreshold, void, (Word));
+  public: static void _setJitTierUpThreshold(TiObject *self, Word threshold);
+
+  public: METHOD_BINDING_CACHE(getJitTierUpThreshold, Word);
+  public: static Word _getJitTierUpThreshold(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitCacheEnabled, void, (Bool));
+  public: static void _setJitCacheEnabled(TiObject *self, Bool enabled);
+
+  public: METHOD_BINDING_CACHE(isJitCacheEnabled, Bool);
+  public: static Bool _isJitCacheEnabled(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitCacheSizeLimit, void, (Word));
+  public: static void _setJitCacheSizeLimit(TiObject *self, Word limit);
+
+  public: METHOD_BINDING_CACHE(getJitCacheSizeLimit, Word);
+  public: static Word _getJitCacheSizeLimit(TiObject *self);
+
   public: METHOD_BINDING_CACHE(raiseBuildNotice, void, (
     Char const* /* code */, Int /* severity */, TiObject* /* astNode */
   ));
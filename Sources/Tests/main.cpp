@@ -144,9 +144,15 @@ Bool checkRunResult(Str const &fileName)
   massagedRunResultContent = std::regex_replace(
     massagedRunResultContent, std::regex(", align [0-9]+"), S("")
   );
+  massagedRunResultContent = std::regex_replace(
+    massagedRunResultContent, std::regex("directory: \"[^\"]*\""), S("directory: \"<sanitized>\"")
+  );
   auto massagedExpectedResultContent = std::regex_replace(
     expectedResultContent, std::regex("target datalayout = \"[a-zA-Z0-9:-]+\""), S("target datalayout = \"<sanitized>\"")
   );
+  massagedExpectedResultContent = std::regex_replace(
+    massagedExpectedResultContent, std::regex("directory: \"[^\"]*\""), S("directory: \"<sanitized>\"")
+  );
 
   // Remove one character from the expectedResultContent because, for some
   // reason, editors seem to append 0A at the end of the file!